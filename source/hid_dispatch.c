@@ -0,0 +1,72 @@
+#include "hid_dispatch.h"
+
+#include "report_item.h"
+
+#include <string.h>
+
+static bool is_routed(const HidField *field)
+{
+    return field->type == HID_REPORT_INPUT && !(field->flags & Constant);
+}
+
+void hid_dispatch_init(HidDispatch *dispatch, const HidLayout *layout)
+{
+    memset(dispatch, 0, sizeof(*dispatch));
+    dispatch->layout = layout;
+
+    /* Count the fields of each report, then place them, keeping the order
+     * in which they appear in the report */
+    for (int i = 0; i < layout->num_fields; i++) {
+        const HidField *field = &layout->fields[i];
+        if (is_routed(field)) dispatch->routes[field->report_id].num_fields++;
+    }
+    int first = 0;
+    for (int id = 0; id < 256; id++) {
+        HidReportRoute *route = &dispatch->routes[id];
+        route->size = hid_layout_report_size(layout, HID_REPORT_INPUT, id);
+        route->first_field = first;
+        first += route->num_fields;
+        route->num_fields = 0;
+    }
+    for (int i = 0; i < layout->num_fields; i++) {
+        const HidField *field = &layout->fields[i];
+        if (!is_routed(field)) continue;
+        HidReportRoute *route = &dispatch->routes[field->report_id];
+        dispatch->fields[route->first_field + route->num_fields++] = i;
+    }
+}
+
+const HidReportRoute *hid_dispatch_route(const HidDispatch *dispatch,
+                                         const uint8_t *report, uint16_t len)
+{
+    uint8_t report_id = 0;
+    if (dispatch->layout->has_report_ids) {
+        if (len == 0) return NULL;
+        report_id = report[0];
+    }
+
+    const HidReportRoute *route = &dispatch->routes[report_id];
+    return route->size != 0 && route->size == len ? route : NULL;
+}
+
+int hid_dispatch_decode(const HidDispatch *dispatch,
+                        const HidReportRoute *route,
+                        const uint8_t *report, uint16_t len,
+                        HidValue *values, int max_values)
+{
+    const HidLayout *layout = dispatch->layout;
+    if (layout->has_report_ids) {
+        report++;
+        len--;
+    }
+
+    int num_values = 0;
+    for (int i = 0; i < route->num_fields; i++) {
+        const HidField *field =
+            &layout->fields[dispatch->fields[route->first_field + i]];
+        int room = max_values > num_values ? max_values - num_values : 0;
+        num_values += hid_field_decode(layout, field, report, len,
+                                       values + num_values, room);
+    }
+    return num_values;
+}
@@ -0,0 +1,46 @@
+#ifndef BTT_HID_DISPATCH_H
+#define BTT_HID_DISPATCH_H
+
+#include "hid_layout.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Routes the input reports of a device by their ID. A table with one entry
+ * per possible first byte, built from the compiled layout, holds the
+ * expected size of each report and where its fields are listed, so that a
+ * report of the wrong size, or with an unknown ID, is rejected with a
+ * single lookup, and decoding only visits the fields of that report.
+ */
+
+typedef struct {
+    uint16_t size; /* ID byte included; 0 if the ID is unknown */
+    /* Input fields of the report, in dispatch->fields */
+    uint8_t first_field;
+    uint8_t num_fields;
+} HidReportRoute;
+
+typedef struct {
+    const HidLayout *layout;
+    HidReportRoute routes[256];
+    /* Indexes into layout->fields of the non-constant input fields,
+     * grouped by report ID */
+    uint8_t fields[HID_LAYOUT_MAX_FIELDS];
+} HidDispatch;
+
+/* The layout must outlive the dispatch table */
+void hid_dispatch_init(HidDispatch *dispatch, const HidLayout *layout);
+
+/* The route of a report, as received (with its ID, if the descriptor uses
+ * them); NULL if the ID is unknown or the size does not match */
+const HidReportRoute *hid_dispatch_route(const HidDispatch *dispatch,
+                                         const uint8_t *report, uint16_t len);
+
+/* Decodes a report which has been routed, as hid_layout_decode() does */
+int hid_dispatch_decode(const HidDispatch *dispatch,
+                        const HidReportRoute *route,
+                        const uint8_t *report, uint16_t len,
+                        HidValue *values, int max_values);
+
+#endif // BTT_HID_DISPATCH_H
@@ -0,0 +1,453 @@
+#include "hid_layout.h"
+
+#include "btstack_util.h"
+#include "report_item.h"
+
+#include <string.h>
+
+#define HID_LONG_ITEM 0xfe
+/* Push without Pop, nested deeper than this, is treated as malformed */
+#define HID_GLOBAL_STACK_DEPTH 8
+
+typedef struct {
+    uint16_t usage_page;
+    int32_t logical_min;
+    int32_t logical_max;
+    int32_t physical_min;
+    int32_t physical_max;
+    uint32_t unit;
+    int8_t unit_exponent;
+    uint8_t report_size;
+    uint8_t report_id;
+    uint16_t report_count;
+} HidGlobals;
+
+typedef struct {
+    HidLayout *layout;
+    HidGlobals globals;
+    HidGlobals stack[HID_GLOBAL_STACK_DEPTH];
+    int stack_depth;
+    /* Usages collected since the last main item start here */
+    int first_usage;
+    bool has_usage_min;
+    bool has_usage_max;
+    uint32_t usage_min;
+    uint32_t usage_max;
+    /* Inside a delimited set only the first usage is used: the others are
+     * alternatives for the same control */
+    bool in_delimiter;
+    bool delimiter_has_usage;
+} HidCompiler;
+
+static uint32_t hid_item_unsigned(const uint8_t *data, uint8_t size)
+{
+    switch (size) {
+    case 1: return data[0];
+    case 2: return data[0] | (data[1] << 8);
+    case 4: return data[0] | (data[1] << 8) | (data[2] << 16) |
+                   ((uint32_t)data[3] << 24);
+    default: return 0;
+    }
+}
+
+static int32_t hid_item_signed(const uint8_t *data, uint8_t size)
+{
+    switch (size) {
+    case 1: return (int8_t)data[0];
+    case 2: return (int16_t)hid_item_unsigned(data, 2);
+    default: return (int32_t)hid_item_unsigned(data, size);
+    }
+}
+
+static uint32_t hid_compiler_usage(const HidCompiler *compiler,
+                                   uint32_t value, uint8_t size)
+{
+    /* 4-byte usages carry their own page */
+    if (size == 4) return value;
+    return ((uint32_t)compiler->globals.usage_page << 16) | (value & 0xffff);
+}
+
+static void hid_compiler_add_usages(HidCompiler *compiler,
+                                    uint32_t first, uint32_t last)
+{
+    HidLayout *layout = compiler->layout;
+    if (first > last) return;
+    if (compiler->in_delimiter) {
+        if (compiler->delimiter_has_usage) return;
+        compiler->delimiter_has_usage = true;
+    }
+    if (layout->num_usages >= HID_LAYOUT_MAX_USAGES) {
+        layout->truncated = true;
+        return;
+    }
+    layout->usages[layout->num_usages].first = first;
+    layout->usages[layout->num_usages].last = last;
+    layout->num_usages++;
+}
+
+static void hid_compiler_reset_locals(HidCompiler *compiler)
+{
+    compiler->first_usage = compiler->layout->num_usages;
+    compiler->has_usage_min = false;
+    compiler->has_usage_max = false;
+    compiler->in_delimiter = false;
+}
+
+static HidKernel hid_field_kernel(const HidField *field)
+{
+    /* Single bits are only read as a mask if they need no sign extension */
+    if (field->bit_size == 1 && field->count <= 32 && field->logical_min >= 0) {
+        return HID_KERNEL_BITS;
+    }
+    if (field->bit_offset % 8 != 0) return HID_KERNEL_GENERIC;
+    switch (field->bit_size) {
+    case 8: return HID_KERNEL_U8;
+    case 16: return HID_KERNEL_U16;
+    case 32: return HID_KERNEL_U32;
+    default: return HID_KERNEL_GENERIC;
+    }
+}
+
+static void hid_compiler_add_field(HidCompiler *compiler, HidReportType type,
+                                   uint8_t flags)
+{
+    HidLayout *layout = compiler->layout;
+    const HidGlobals *globals = &compiler->globals;
+
+    uint16_t *bits = &layout->report_bits[type][globals->report_id];
+    uint16_t bit_offset = *bits;
+    uint32_t end = bit_offset + (uint32_t)globals->report_size * globals->report_count;
+    if (end > UINT16_MAX) {
+        layout->truncated = true;
+        return;
+    }
+    *bits = end;
+
+    if (globals->report_size == 0 || globals->report_count == 0) return;
+    if (globals->report_size > 32 ||
+        layout->num_fields >= HID_LAYOUT_MAX_FIELDS) {
+        layout->truncated = true;
+        return;
+    }
+
+    HidField *field = &layout->fields[layout->num_fields++];
+    field->report_id = globals->report_id;
+    field->type = type;
+    field->flags = flags;
+    field->bit_size = globals->report_size;
+    field->bit_offset = bit_offset;
+    field->count = globals->report_count;
+    field->logical_min = globals->logical_min;
+    field->logical_max = globals->logical_max;
+    field->physical_min = globals->physical_min;
+    field->physical_max = globals->physical_max;
+    field->first_usage = compiler->first_usage;
+    field->num_usages = layout->num_usages - compiler->first_usage;
+    field->kernel = hid_field_kernel(field);
+}
+
+static void hid_compiler_main_item(HidCompiler *compiler, uint8_t tag,
+                                   uint32_t data)
+{
+    switch (tag) {
+    case Input(0):
+        hid_compiler_add_field(compiler, HID_REPORT_INPUT, data);
+        break;
+    case Output(0):
+        hid_compiler_add_field(compiler, HID_REPORT_OUTPUT, data);
+        break;
+    case Feature(0):
+        hid_compiler_add_field(compiler, HID_REPORT_FEATURE, data);
+        break;
+    }
+    hid_compiler_reset_locals(compiler);
+}
+
+/* Returns false on stack overflow or underflow */
+static bool hid_compiler_global_item(HidCompiler *compiler, uint8_t tag,
+                                     const uint8_t *data, uint8_t size)
+{
+    HidGlobals *globals = &compiler->globals;
+    uint32_t value = hid_item_unsigned(data, size);
+
+    switch (tag) {
+    case Usage_Page(0):
+        globals->usage_page = value;
+        break;
+    case Logical_Minimum(0):
+        globals->logical_min = hid_item_signed(data, size);
+        break;
+    case Logical_Maximum(0):
+        globals->logical_max = hid_item_signed(data, size);
+        /* Descriptors often give unsigned maximums, such as 0xff in a
+         * single byte, where the minimum is not negative */
+        if (globals->logical_max < globals->logical_min) {
+            globals->logical_max = value;
+        }
+        break;
+    case Physical_Minimum(0):
+        globals->physical_min = hid_item_signed(data, size);
+        break;
+    case Physical_Maximum(0):
+        globals->physical_max = hid_item_signed(data, size);
+        if (globals->physical_max < globals->physical_min) {
+            globals->physical_max = value;
+        }
+        break;
+    case Unit_Exponent(0):
+        /* A 4-bit signed value */
+        globals->unit_exponent = (value & 0x08) ? (int8_t)(value | 0xf0) : value & 0x0f;
+        break;
+    case Unit(0):
+        globals->unit = value;
+        break;
+    case Report_Size(0):
+        globals->report_size = value > 255 ? 255 : value;
+        break;
+    case Report_ID(0):
+        globals->report_id = value;
+        compiler->layout->has_report_ids = true;
+        break;
+    case Report_Count(0):
+        globals->report_count = value > 0xffff ? 0xffff : value;
+        break;
+    case Push(0):
+        if (compiler->stack_depth >= HID_GLOBAL_STACK_DEPTH) return false;
+        compiler->stack[compiler->stack_depth++] = *globals;
+        break;
+    case Pop(0):
+        if (compiler->stack_depth == 0) return false;
+        *globals = compiler->stack[--compiler->stack_depth];
+        break;
+    }
+    return true;
+}
+
+static void hid_compiler_local_item(HidCompiler *compiler, uint8_t tag,
+                                    const uint8_t *data, uint8_t size)
+{
+    uint32_t usage = hid_compiler_usage(compiler,
+                                        hid_item_unsigned(data, size), size);
+
+    switch (tag) {
+    case Usage(0):
+        hid_compiler_add_usages(compiler, usage, usage);
+        break;
+    case Usage_Minimum(0):
+        compiler->has_usage_min = true;
+        compiler->usage_min = usage;
+        break;
+    case Usage_Maximum(0):
+        compiler->has_usage_max = true;
+        compiler->usage_max = usage;
+        break;
+    case Delimiter(0):
+        compiler->in_delimiter = hid_item_unsigned(data, size) == 1;
+        compiler->delimiter_has_usage = false;
+        break;
+    }
+
+    /* The two ends of a range may come in either order */
+    if (compiler->has_usage_min && compiler->has_usage_max) {
+        hid_compiler_add_usages(compiler, compiler->usage_min,
+                                compiler->usage_max);
+        compiler->has_usage_min = false;
+        compiler->has_usage_max = false;
+    }
+}
+
+bool hid_layout_compile(HidLayout *layout, const uint8_t *descriptor,
+                        uint16_t len)
+{
+    HidCompiler compiler;
+    memset(&compiler, 0, sizeof(compiler));
+    memset(layout, 0, sizeof(*layout));
+    compiler.layout = layout;
+
+    uint16_t index = 0;
+    while (index < len) {
+        uint8_t prefix = descriptor[index];
+        if (prefix == HID_LONG_ITEM) {
+            /* Long items are reserved: skip them */
+            if (index + 1 >= len) return false;
+            index += 3 + descriptor[index + 1];
+            continue;
+        }
+
+        uint8_t tag = prefix & TAG_MASK;
+        uint8_t size = (prefix & SIZE_MASK) == Size_4B ? 4 : prefix & SIZE_MASK;
+        if (index + 1 + size > len) return false;
+
+        const uint8_t *data = &descriptor[index + 1];
+        switch (tag & TYPE_MASK) {
+        case MAIN_ITEM:
+            hid_compiler_main_item(&compiler, tag, hid_item_unsigned(data, size));
+            break;
+        case GLOBAL_ITEM:
+            if (!hid_compiler_global_item(&compiler, tag, data, size)) {
+                return false;
+            }
+            break;
+        case LOCAL_ITEM:
+            hid_compiler_local_item(&compiler, tag, data, size);
+            break;
+        }
+        index += 1 + size;
+    }
+    return index == len;
+}
+
+static uint32_t hid_extract_generic(const uint8_t *report, uint16_t len,
+                                    uint32_t bit, uint8_t bit_size)
+{
+    uint32_t byte = bit / 8;
+    uint32_t shift = bit % 8;
+    int num_bytes = (shift + bit_size + 7) / 8;
+
+    /* Fields are little endian and need not be byte aligned */
+    uint64_t word = 0;
+    for (int i = 0; i < num_bytes && byte + i < len; i++) {
+        word |= (uint64_t)report[byte + i] << (8 * i);
+    }
+
+    uint32_t mask = bit_size >= 32 ? 0xffffffff : (1u << bit_size) - 1;
+    return (word >> shift) & mask;
+}
+
+int32_t hid_field_extract(const HidField *field, const uint8_t *report,
+                          uint16_t len, uint16_t index)
+{
+    uint32_t bit = field->bit_offset + (uint32_t)index * field->bit_size;
+    uint32_t byte = bit / 8;
+    bool is_signed = field->logical_min < 0;
+
+    /* The byte aligned kernels only run when the value is all there */
+    switch (field->kernel) {
+    case HID_KERNEL_U8:
+        if (byte >= len) break;
+        return is_signed ? (int8_t)report[byte] : report[byte];
+    case HID_KERNEL_U16:
+        if (byte + 2 > len) break;
+        return is_signed ? (int16_t)little_endian_read_16(report, byte) :
+                           little_endian_read_16(report, byte);
+    case HID_KERNEL_U32:
+        if (byte + 4 > len) break;
+        return (int32_t)little_endian_read_32(report, byte);
+    case HID_KERNEL_BITS:
+        return byte < len ? (report[byte] >> (bit % 8)) & 1 : 0;
+    }
+
+    uint32_t value = hid_extract_generic(report, len, bit, field->bit_size);
+    if (is_signed && field->bit_size < 32 &&
+        (value & (1u << (field->bit_size - 1)))) {
+        value |= ~((1u << field->bit_size) - 1);
+    }
+    return (int32_t)value;
+}
+
+uint32_t hid_field_extract_mask(const HidField *field, const uint8_t *report,
+                                uint16_t len)
+{
+    return hid_extract_generic(report, len, field->bit_offset, field->count);
+}
+
+void hid_field_insert(const HidField *field, uint8_t *report, uint16_t len,
+                      uint16_t index, int32_t value)
+{
+    uint32_t bit = field->bit_offset + (uint32_t)index * field->bit_size;
+    uint32_t byte = bit / 8;
+    uint32_t shift = bit % 8;
+    int num_bytes = (shift + field->bit_size + 7) / 8;
+
+    uint64_t mask = field->bit_size >= 32 ? 0xffffffff :
+        (1u << field->bit_size) - 1;
+    uint64_t word = ((uint32_t)value & mask) << shift;
+    mask <<= shift;
+    for (int i = 0; i < num_bytes && byte + i < len; i++) {
+        report[byte + i] = (report[byte + i] & ~(uint8_t)(mask >> (8 * i))) |
+            (uint8_t)(word >> (8 * i));
+    }
+}
+
+uint16_t hid_layout_report_size(const HidLayout *layout, HidReportType type,
+                                uint8_t report_id)
+{
+    uint16_t bits = layout->report_bits[type][report_id];
+    if (bits == 0) return 0;
+    return (bits + 7) / 8 + (layout->has_report_ids ? 1 : 0);
+}
+
+uint16_t hid_layout_max_report_size(const HidLayout *layout, HidReportType type)
+{
+    uint16_t max_size = 0;
+    for (int id = 0; id < 256; id++) {
+        uint16_t size = hid_layout_report_size(layout, type, id);
+        if (size > max_size) max_size = size;
+    }
+    return max_size;
+}
+
+uint32_t hid_field_usage(const HidLayout *layout, const HidField *field,
+                         uint32_t index)
+{
+    if (field->num_usages == 0) return 0;
+
+    const HidUsageRange *range = &layout->usages[field->first_usage];
+    for (int i = 0; i < field->num_usages; i++, range++) {
+        uint32_t span = range->last - range->first;
+        if (index <= span) return range->first + index;
+        index -= span + 1;
+    }
+    return range[-1].last;
+}
+
+int hid_field_decode(const HidLayout *layout, const HidField *field,
+                     const uint8_t *report, uint16_t len,
+                     HidValue *values, int max_values)
+{
+    /* Button packs are read in one go */
+    uint32_t mask = field->kernel == HID_KERNEL_BITS ?
+        hid_field_extract_mask(field, report, len) : 0;
+    for (uint16_t n = 0; n < field->count && n < max_values; n++) {
+        HidValue *value = &values[n];
+        value->field = field;
+        value->index = n;
+        value->value = field->kernel == HID_KERNEL_BITS ?
+            (mask >> n) & 1 : hid_field_extract(field, report, len, n);
+        if (field->flags & Variable) {
+            value->usage = hid_field_usage(layout, field, n);
+        } else if (value->value >= field->logical_min &&
+                   value->value <= field->logical_max) {
+            /* Array values are indexes into the usages */
+            value->usage = hid_field_usage(layout, field,
+                                           value->value - field->logical_min);
+        } else {
+            value->usage = 0;
+        }
+    }
+    return field->count;
+}
+
+int hid_layout_decode(const HidLayout *layout, const uint8_t *report,
+                      uint16_t len, HidValue *values, int max_values)
+{
+    uint8_t report_id = 0;
+    if (layout->has_report_ids) {
+        if (len == 0) return 0;
+        report_id = report[0];
+        report++;
+        len--;
+    }
+
+    int num_values = 0;
+    for (int i = 0; i < layout->num_fields; i++) {
+        const HidField *field = &layout->fields[i];
+        if (field->type != HID_REPORT_INPUT || field->report_id != report_id ||
+            (field->flags & Constant)) continue;
+
+        int room = max_values > num_values ? max_values - num_values : 0;
+        num_values += hid_field_decode(layout, field, report, len,
+                                       values + num_values, room);
+    }
+    return num_values;
+}
@@ -0,0 +1,118 @@
+#ifndef BTT_HID_LAYOUT_H
+#define BTT_HID_LAYOUT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * The fields of the reports described by a HID report descriptor, compiled
+ * once into a flat table, so that a report can be decoded by extracting the
+ * bits of each field in turn instead of interpreting the descriptor again.
+ */
+
+#define HID_LAYOUT_MAX_FIELDS 64
+#define HID_LAYOUT_MAX_USAGES 128
+
+typedef enum {
+    HID_REPORT_INPUT = 0,
+    HID_REPORT_OUTPUT,
+    HID_REPORT_FEATURE,
+    HID_REPORT_NUM_TYPES,
+} HidReportType;
+
+/* Usages carry their page in the upper 16 bits */
+typedef struct {
+    uint32_t first;
+    uint32_t last;
+} HidUsageRange;
+
+/* How the values of a field are extracted, picked when it is compiled */
+typedef enum {
+    HID_KERNEL_GENERIC = 0, /* any width, any offset */
+    HID_KERNEL_U8, /* byte aligned, 8 bits */
+    HID_KERNEL_U16, /* byte aligned, 16 bits */
+    HID_KERNEL_U32, /* byte aligned, 32 bits */
+    HID_KERNEL_BITS, /* 1 bit, up to 32 values: read as a single mask */
+} HidKernel;
+
+typedef struct {
+    uint8_t report_id; /* 0 if the descriptor does not use report IDs */
+    uint8_t type; /* HidReportType */
+    uint8_t flags; /* Data byte of the main item: Constant, Variable... */
+    uint8_t bit_size; /* of each value, up to 32 */
+    uint8_t kernel; /* HidKernel */
+    uint16_t bit_offset; /* from the start of the report, ID excluded */
+    uint16_t count;
+    int32_t logical_min;
+    int32_t logical_max;
+    int32_t physical_min;
+    int32_t physical_max;
+    /* Usages of the field, in layout->usages: a variable field takes one
+     * per value, an array field maps each value to one */
+    uint16_t first_usage;
+    uint8_t num_usages;
+} HidField;
+
+typedef struct {
+    HidField fields[HID_LAYOUT_MAX_FIELDS];
+    int num_fields;
+    HidUsageRange usages[HID_LAYOUT_MAX_USAGES];
+    int num_usages;
+    bool has_report_ids;
+    /* Some fields or usages did not fit, and were dropped */
+    bool truncated;
+    /* Length of each report, in bits and without the ID byte, by type and
+     * ID; constant fields are included */
+    uint16_t report_bits[HID_REPORT_NUM_TYPES][256];
+} HidLayout;
+
+typedef struct {
+    const HidField *field;
+    uint16_t index; /* of the value within the field */
+    uint32_t usage; /* 0 if unknown, or for an empty array slot */
+    int32_t value;
+} HidValue;
+
+/* Returns false if the descriptor is malformed; the fields found up to
+ * that point are kept */
+bool hid_layout_compile(HidLayout *layout, const uint8_t *descriptor,
+                        uint16_t len);
+
+/* Size in bytes of a report as sent on the wire, ID byte included; 0 if
+ * the descriptor declares no such report */
+uint16_t hid_layout_report_size(const HidLayout *layout, HidReportType type,
+                                uint8_t report_id);
+/* Size of the largest report of the given type */
+uint16_t hid_layout_max_report_size(const HidLayout *layout, HidReportType type);
+
+/* Extracts the index-th value of field from report, which starts after the
+ * report ID; values beyond len read as 0 */
+int32_t hid_field_extract(const HidField *field, const uint8_t *report,
+                          uint16_t len, uint16_t index);
+/* Extracts all the values of a HID_KERNEL_BITS field, the first one in the
+ * lowest bit */
+uint32_t hid_field_extract_mask(const HidField *field, const uint8_t *report,
+                                uint16_t len);
+/* Stores the index-th value of field into report, which starts after the
+ * report ID, truncated to the size of the field; bits beyond len are lost */
+void hid_field_insert(const HidField *field, uint8_t *report, uint16_t len,
+                      uint16_t index, int32_t value);
+/* The usage of the index-th usage of field, repeating the last one */
+uint32_t hid_field_usage(const HidLayout *layout, const HidField *field,
+                         uint32_t index);
+
+/* Decodes the values of field from report, which starts after the report ID,
+ * into up to max_values values; returns the number of values of the field */
+int hid_field_decode(const HidLayout *layout, const HidField *field,
+                     const uint8_t *report, uint16_t len,
+                     HidValue *values, int max_values);
+
+/*
+ * Decodes an input report, as received (with its ID, if the descriptor uses
+ * them), into values. Constant fields are skipped. Returns the number of
+ * values found, which may be more than max_values.
+ */
+int hid_layout_decode(const HidLayout *layout, const uint8_t *report,
+                      uint16_t len, HidValue *values, int max_values);
+
+#endif // BTT_HID_LAYOUT_H
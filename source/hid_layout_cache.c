@@ -0,0 +1,288 @@
+#include "hid_layout_cache.h"
+
+#include "btstack_util.h"
+#include "sdp_cache.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define HID_LAYOUT_CACHE_DIR SDP_CACHE_DIR "/hid"
+#define HID_LAYOUT_CACHE_MAGIC 0x4849444c /* "HIDL" */
+/* The layout is saved as it is in memory: bump this when HidLayout, or the
+ * way it is compiled, changes */
+#define HID_LAYOUT_CACHE_VERSION 3
+
+typedef struct {
+    uint32_t crc;
+    uint16_t len;
+} HidFingerprint;
+
+/* Followed by the descriptor, then by the layout */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t descriptor_len;
+    uint32_t descriptor_crc;
+    uint32_t layout_size;
+} HidLayoutCacheHeader;
+
+typedef struct {
+    HidFingerprint fingerprint;
+    /* The fingerprint only picks the candidate: the CRC can collide, so a
+     * layout is only reused if the descriptor is the same, byte by byte */
+    uint8_t *descriptor;
+    uint8_t bdaddr[6]; /* of the last device which sent the descriptor */
+    uint32_t last_used;
+    bool used;
+    /* Still to be written by hid_layout_cache_save() */
+    bool layout_dirty;
+    bool device_dirty;
+    HidLayout layout;
+} HidLayoutCacheEntry;
+
+static HidLayoutCacheEntry s_entries[HID_LAYOUT_CACHE_ENTRIES];
+static uint32_t s_clock = 0;
+
+static void layout_path(char *path, const HidFingerprint *fingerprint)
+{
+    sprintf(path, HID_LAYOUT_CACHE_DIR "/%08x-%04x.layout",
+            (unsigned)fingerprint->crc, fingerprint->len);
+}
+
+static void device_path(char *path, const uint8_t *bdaddr)
+{
+    sprintf(path, HID_LAYOUT_CACHE_DIR "/%02x%02x%02x%02x%02x%02x.hid",
+            bdaddr[0], bdaddr[1], bdaddr[2], bdaddr[3], bdaddr[4], bdaddr[5]);
+}
+
+/* Writes the header, then the descriptor, then the data */
+static bool write_file(const char *path, const void *header, size_t header_size,
+                       const uint8_t *descriptor, uint16_t len,
+                       const void *data, size_t size)
+{
+    mkdir(HID_LAYOUT_CACHE_DIR, 0777);
+    FILE *file = fopen(path, "wb");
+    if (!file) return false;
+
+    bool ok = fwrite(header, header_size, 1, file) == 1 &&
+        (len == 0 || fwrite(descriptor, len, 1, file) == 1) &&
+        (size == 0 || fwrite(data, size, 1, file) == 1);
+    fclose(file);
+
+    /* Don't leave a half-written file behind */
+    if (!ok) remove(path);
+    return ok;
+}
+
+/* Compares the next len bytes of file with descriptor */
+static bool read_matches(FILE *file, const uint8_t *descriptor, uint16_t len)
+{
+    uint8_t buffer[64];
+    while (len > 0) {
+        uint16_t chunk = len < sizeof(buffer) ? len : sizeof(buffer);
+        if (fread(buffer, chunk, 1, file) != 1 ||
+            memcmp(buffer, descriptor, chunk) != 0) return false;
+        descriptor += chunk;
+        len -= chunk;
+    }
+    return true;
+}
+
+static HidLayoutCacheEntry *find_entry(const HidFingerprint *fingerprint,
+                                       const uint8_t *descriptor)
+{
+    for (int i = 0; i < HID_LAYOUT_CACHE_ENTRIES; i++) {
+        HidLayoutCacheEntry *entry = &s_entries[i];
+        if (entry->used && entry->fingerprint.crc == fingerprint->crc &&
+            entry->fingerprint.len == fingerprint->len &&
+            memcmp(entry->descriptor, descriptor, fingerprint->len) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/* The least recently used entry, or an unused one */
+static HidLayoutCacheEntry *take_entry()
+{
+    HidLayoutCacheEntry *oldest = &s_entries[0];
+    for (int i = 0; i < HID_LAYOUT_CACHE_ENTRIES; i++) {
+        HidLayoutCacheEntry *entry = &s_entries[i];
+        if (!entry->used) return entry;
+        if (entry->last_used < oldest->last_used) oldest = entry;
+    }
+    return oldest;
+}
+
+static bool load_layout(const HidFingerprint *fingerprint,
+                        const uint8_t *descriptor, HidLayout *layout)
+{
+    if (!sdp_cache_is_available()) return false;
+
+    char path[64];
+    layout_path(path, fingerprint);
+    FILE *file = fopen(path, "rb");
+    if (!file) return false;
+
+    HidLayoutCacheHeader header;
+    bool ok = fread(&header, sizeof(header), 1, file) == 1 &&
+        header.magic == HID_LAYOUT_CACHE_MAGIC &&
+        header.version == HID_LAYOUT_CACHE_VERSION &&
+        header.descriptor_crc == fingerprint->crc &&
+        header.descriptor_len == fingerprint->len &&
+        header.layout_size == sizeof(*layout) &&
+        read_matches(file, descriptor, fingerprint->len) &&
+        fread(layout, sizeof(*layout), 1, file) == 1;
+    fclose(file);
+    return ok;
+}
+
+static void save_layout(const HidLayoutCacheEntry *entry)
+{
+    if (!sdp_cache_is_available()) return;
+
+    char path[64];
+    layout_path(path, &entry->fingerprint);
+    HidLayoutCacheHeader header = {
+        .magic = HID_LAYOUT_CACHE_MAGIC,
+        .version = HID_LAYOUT_CACHE_VERSION,
+        .descriptor_len = entry->fingerprint.len,
+        .descriptor_crc = entry->fingerprint.crc,
+        .layout_size = sizeof(entry->layout),
+    };
+    write_file(path, &header, sizeof(header),
+               entry->descriptor, entry->fingerprint.len,
+               &entry->layout, sizeof(entry->layout));
+}
+
+static void save_device(const HidLayoutCacheEntry *entry)
+{
+    if (!sdp_cache_is_available()) return;
+
+    char path[64];
+    device_path(path, entry->bdaddr);
+    /* The whole descriptor, so that the device does not depend on its
+     * layout file, which another descriptor with the same CRC could take */
+    write_file(path, &entry->fingerprint, sizeof(entry->fingerprint),
+               entry->descriptor, entry->fingerprint.len, NULL, 0);
+}
+
+/* Returns NULL if there is no memory for the copy of the descriptor: the
+ * layout is then just not cached */
+static HidLayoutCacheEntry *store_entry(const HidFingerprint *fingerprint,
+                                        const uint8_t *descriptor,
+                                        const HidLayout *layout)
+{
+    uint8_t *copy = malloc(fingerprint->len);
+    if (!copy) return NULL;
+    memcpy(copy, descriptor, fingerprint->len);
+
+    HidLayoutCacheEntry *entry = take_entry();
+    free(entry->descriptor);
+    entry->descriptor = copy;
+    entry->used = true;
+    entry->layout_dirty = false;
+    entry->device_dirty = false;
+    entry->fingerprint = *fingerprint;
+    memset(entry->bdaddr, 0, sizeof(entry->bdaddr));
+    memcpy(&entry->layout, layout, sizeof(*layout));
+    return entry;
+}
+
+/* Looks the descriptor up in RAM, then on SD, and compiles it if it is in
+ * neither; *entry is set to NULL if the layout could not be cached */
+static bool get_layout(HidLayout *layout, const uint8_t *descriptor,
+                       uint16_t len, HidLayoutCacheEntry **entry)
+{
+    HidFingerprint fingerprint = {
+        .crc = btstack_crc32_finalize(
+            btstack_crc32_update(btstack_crc32_init(), descriptor, len)),
+        .len = len,
+    };
+
+    *entry = find_entry(&fingerprint, descriptor);
+    if (*entry) {
+        memcpy(layout, &(*entry)->layout, sizeof(*layout));
+    } else if (load_layout(&fingerprint, descriptor, layout)) {
+        *entry = store_entry(&fingerprint, descriptor, layout);
+    } else {
+        /* Malformed descriptors are not cached, so that they are reported
+         * every time */
+        if (!hid_layout_compile(layout, descriptor, len)) return false;
+        *entry = store_entry(&fingerprint, descriptor, layout);
+        if (*entry) (*entry)->layout_dirty = true;
+    }
+
+    if (*entry) (*entry)->last_used = ++s_clock;
+    return true;
+}
+
+bool hid_layout_cache_get(HidLayout *layout, const uint8_t *bdaddr,
+                          const uint8_t *descriptor, uint16_t len)
+{
+    HidLayoutCacheEntry *entry;
+    if (!get_layout(layout, descriptor, len, &entry)) return false;
+
+    /* Remember which descriptor the device sent, unless it is known */
+    if (entry && memcmp(entry->bdaddr, bdaddr, sizeof(entry->bdaddr)) != 0) {
+        memcpy(entry->bdaddr, bdaddr, sizeof(entry->bdaddr));
+        entry->device_dirty = true;
+    }
+    return true;
+}
+
+bool hid_layout_cache_get_for_device(HidLayout *layout, const uint8_t *bdaddr)
+{
+    for (int i = 0; i < HID_LAYOUT_CACHE_ENTRIES; i++) {
+        HidLayoutCacheEntry *entry = &s_entries[i];
+        if (entry->used &&
+            memcmp(entry->bdaddr, bdaddr, sizeof(entry->bdaddr)) == 0) {
+            entry->last_used = ++s_clock;
+            memcpy(layout, &entry->layout, sizeof(*layout));
+            return true;
+        }
+    }
+
+    if (!sdp_cache_is_available()) return false;
+
+    char path[64];
+    device_path(path, bdaddr);
+    FILE *file = fopen(path, "rb");
+    if (!file) return false;
+
+    HidFingerprint fingerprint;
+    uint8_t *descriptor = NULL;
+    bool ok = fread(&fingerprint, sizeof(fingerprint), 1, file) == 1 &&
+        (descriptor = malloc(fingerprint.len)) != NULL &&
+        (fingerprint.len == 0 ||
+         fread(descriptor, fingerprint.len, 1, file) == 1);
+    fclose(file);
+
+    HidLayoutCacheEntry *entry = NULL;
+    ok = ok && get_layout(layout, descriptor, fingerprint.len, &entry);
+    free(descriptor);
+    if (!ok) return false;
+
+    /* Read back from its file: the device file needs no writing */
+    if (entry) memcpy(entry->bdaddr, bdaddr, sizeof(entry->bdaddr));
+    return true;
+}
+
+void hid_layout_cache_save()
+{
+    for (int i = 0; i < HID_LAYOUT_CACHE_ENTRIES; i++) {
+        HidLayoutCacheEntry *entry = &s_entries[i];
+        if (!entry->used) continue;
+        /* The device file refers to the layout, which goes first */
+        if (entry->layout_dirty) {
+            save_layout(entry);
+            entry->layout_dirty = false;
+        }
+        if (entry->device_dirty) {
+            save_device(entry);
+            entry->device_dirty = false;
+        }
+    }
+}
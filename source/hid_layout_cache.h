@@ -0,0 +1,35 @@
+#ifndef BTT_HID_LAYOUT_CACHE_H
+#define BTT_HID_LAYOUT_CACHE_H
+
+#include "hid_layout.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Compiled HID layouts, keyed by the CRC32 and length of the report
+ * descriptor they come from: devices of the same model send the same
+ * descriptor, so it only needs to be compiled once. A copy of the
+ * descriptor is kept with each layout, and compared before the layout is
+ * reused. Layouts are kept in RAM and saved next to the SDP cache,
+ * together with the last descriptor seen for each device, so that a device
+ * which reconnects gets its layout without reading its descriptor again.
+ */
+
+#define HID_LAYOUT_CACHE_ENTRIES 4
+
+/* Copies into layout the compiled descriptor, compiling it only if it is
+ * not cached; returns false if the descriptor is malformed. Nothing is
+ * written to SD until hid_layout_cache_save() is called. */
+bool hid_layout_cache_get(HidLayout *layout, const uint8_t *bdaddr,
+                          const uint8_t *descriptor, uint16_t len);
+
+/* Copies into layout the layout last seen for the device; returns false if
+ * there is none */
+bool hid_layout_cache_get_for_device(HidLayout *layout, const uint8_t *bdaddr);
+
+/* Writes the layouts and device files which have changed; called from the
+ * main loop, since it blocks on the SD card */
+void hid_layout_cache_save(void);
+
+#endif // BTT_HID_LAYOUT_CACHE_H
@@ -0,0 +1,119 @@
+#include "hid_output.h"
+
+#include "report_item.h"
+
+#include <string.h>
+
+#define HID_TRANS_SET_REPORT_OUTPUT 0x52
+#define HID_TRANS_SET_REPORT_FEATURE 0x53
+#define HID_TRANS_DATA_OUTPUT 0xa2
+
+/* The index of the report in output->reports, -1 if it was left out */
+static int find_report(const HidOutput *output, uint8_t type,
+                       uint8_t report_id)
+{
+    for (int i = 0; i < output->num_reports; i++) {
+        const HidOutputReport *report = &output->reports[i];
+        if (report->type == type && report->report_id == report_id) return i;
+    }
+    return -1;
+}
+
+void hid_output_init(HidOutput *output, const HidLayout *layout)
+{
+    memset(output, 0, sizeof(*output));
+    output->layout = layout;
+
+    for (int type = HID_REPORT_OUTPUT; type <= HID_REPORT_FEATURE; type++) {
+        for (int id = 0; id < 256; id++) {
+            uint16_t size = hid_layout_report_size(layout, type, id);
+            if (size == 0 || size > HID_OUTPUT_MAX_REPORT_SIZE ||
+                output->num_reports >= HID_OUTPUT_MAX_REPORTS) continue;
+
+            /* All zeroes until a value is set */
+            HidOutputReport *report = &output->reports[output->num_reports++];
+            report->type = type;
+            report->report_id = id;
+            report->size = size;
+            if (layout->has_report_ids) report->data[1] = id;
+        }
+    }
+}
+
+bool hid_output_set(HidOutput *output, const HidField *field, uint16_t index,
+                    int32_t value)
+{
+    if (field->type == HID_REPORT_INPUT || index >= field->count) return false;
+
+    int slot = find_report(output, field->type, field->report_id);
+    if (slot < 0) return false;
+    HidOutputReport *report = &output->reports[slot];
+
+    /* Skip the header and the ID */
+    int start = output->layout->has_report_ids ? 2 : 1;
+    hid_field_insert(field, report->data + start, report->size + 1 - start,
+                     index, value);
+    report->dirty = true;
+    output->num_updates++;
+    return true;
+}
+
+int hid_output_next_field(const HidOutput *output, int field)
+{
+    const HidLayout *layout = output->layout;
+    for (int i = 1; i <= layout->num_fields; i++) {
+        int index = (field + i) % layout->num_fields;
+        const HidField *f = &layout->fields[index];
+        if (f->type != HID_REPORT_INPUT && !(f->flags & Constant) &&
+            find_report(output, f->type, f->report_id) >= 0) return index;
+    }
+    return -1;
+}
+
+static void update_rate(HidOutput *output, uint64_t time_us)
+{
+    if (output->window_start_us == 0) output->window_start_us = time_us;
+
+    uint64_t elapsed = time_us - output->window_start_us;
+    if (elapsed >= HID_OUTPUT_WINDOW_US) {
+        output->sends_per_sec =
+            (uint64_t)output->window_sends * 1000000 / elapsed;
+        output->window_start_us = time_us;
+        output->window_sends = 0;
+    }
+}
+
+int hid_output_flush(HidOutput *output, BtL2capHandle *ctrl_handle,
+                     BtL2capHandle *intr_handle, uint64_t time_us)
+{
+    int num_sent = 0;
+    for (int i = 0; i < output->num_reports; i++) {
+        HidOutputReport *report = &output->reports[i];
+        if (!report->dirty) continue;
+
+        BtL2capHandle *handle;
+        if (report->type == HID_REPORT_FEATURE) {
+            report->data[0] = HID_TRANS_SET_REPORT_FEATURE;
+            handle = ctrl_handle;
+        } else if (intr_handle) {
+            report->data[0] = HID_TRANS_DATA_OUTPUT;
+            handle = intr_handle;
+        } else {
+            report->data[0] = HID_TRANS_SET_REPORT_OUTPUT;
+            handle = ctrl_handle;
+        }
+
+        /* Kept dirty on errors, so that the next flush tries again */
+        if (bt_l2cap_handle_write(handle, report->data, report->size + 1) != 0) {
+            output->num_errors++;
+            continue;
+        }
+        report->dirty = false;
+        output->num_sends++;
+        output->window_sends++;
+        num_sent++;
+    }
+
+    update_rate(output, time_us);
+    return num_sent;
+}
@@ -0,0 +1,66 @@
+#ifndef BTT_HID_OUTPUT_H
+#define BTT_HID_OUTPUT_H
+
+#include "bluetooth.h"
+#include "hid_layout.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Output and feature reports, built from the fields the descriptor declares
+ * for them. Setting a value only changes the copy of its report kept here;
+ * the reports which changed are sent when the frame is flushed, one write
+ * each, so that a device never sees a burst of small writes, however many
+ * values were set.
+ */
+
+#define HID_OUTPUT_MAX_REPORTS 8
+#define HID_OUTPUT_MAX_REPORT_SIZE 64 /* ID byte included */
+/* The send rate is published once per window */
+#define HID_OUTPUT_WINDOW_US 1000000
+
+typedef struct {
+    uint8_t type; /* HID_REPORT_OUTPUT or HID_REPORT_FEATURE */
+    uint8_t report_id;
+    uint16_t size; /* ID byte included */
+    bool dirty;
+    /* The transaction header, then the report */
+    uint8_t data[1 + HID_OUTPUT_MAX_REPORT_SIZE];
+} HidOutputReport;
+
+typedef struct {
+    const HidLayout *layout;
+    HidOutputReport reports[HID_OUTPUT_MAX_REPORTS];
+    int num_reports;
+    uint32_t num_updates; /* values set */
+    uint32_t num_sends;
+    uint32_t num_errors; /* failed writes */
+    uint64_t window_start_us;
+    uint32_t window_sends;
+    uint32_t sends_per_sec;
+} HidOutput;
+
+/* Reports which do not fit are left out; the layout must outlive output */
+void hid_output_init(HidOutput *output, const HidLayout *layout);
+
+/* Sets the index-th value of an output or feature field; returns false if
+ * its report was left out */
+bool hid_output_set(HidOutput *output, const HidField *field, uint16_t index,
+                    int32_t value);
+
+/* The index in layout->fields of the first output or feature field after
+ * the given one, wrapping around; constant fields, and fields of the reports
+ * left out, are skipped. Returns -1 if there is none. */
+int hid_output_next_field(const HidOutput *output, int field);
+
+/*
+ * Sends the reports changed since the last flush: feature reports as
+ * SET_REPORT on the control channel, output reports as DATA on the
+ * interrupt channel, or as SET_REPORT if it is not open. Returns the number
+ * of reports sent.
+ */
+int hid_output_flush(HidOutput *output, BtL2capHandle *ctrl_handle,
+                     BtL2capHandle *intr_handle, uint64_t time_us);
+
+#endif // BTT_HID_OUTPUT_H
@@ -0,0 +1,78 @@
+#include "hid_stream.h"
+
+#include <string.h>
+
+void hid_stream_init(HidStream *stream)
+{
+    memset(stream, 0, sizeof(*stream));
+}
+
+static void hid_stream_update_stats(HidStream *stream, uint64_t time_us)
+{
+    if (stream->num_reports == 0) {
+        stream->window_start_us = time_us;
+    } else {
+        uint32_t interval = time_us - stream->last_time_us;
+        if (stream->window_reports == 0 || interval < stream->window_min_us) {
+            stream->window_min_us = interval;
+        }
+        if (interval > stream->window_max_us) {
+            stream->window_max_us = interval;
+        }
+        if (stream->num_reports > 1) {
+            int32_t delta = interval - stream->last_interval_us;
+            if (delta < 0) delta = -delta;
+            /* J += (|D| - J) / 16, kept scaled by 16 */
+            stream->jitter += delta - ((stream->jitter + 8) >> 4);
+        }
+        stream->last_interval_us = interval;
+        stream->window_reports++;
+    }
+    stream->last_time_us = time_us;
+    stream->num_reports++;
+
+    uint64_t elapsed = time_us - stream->window_start_us;
+    if (elapsed >= HID_STREAM_WINDOW_US) {
+        HidStreamStats *stats = &stream->stats;
+        stats->reports_per_sec =
+            (uint64_t)stream->window_reports * 1000000 / elapsed;
+        stats->min_interval_us = stream->window_min_us;
+        stats->max_interval_us = stream->window_max_us;
+        stats->jitter_us = stream->jitter >> 4;
+        stream->window_start_us = time_us;
+        stream->window_reports = 0;
+        stream->window_min_us = 0;
+        stream->window_max_us = 0;
+    }
+}
+
+bool hid_stream_push(HidStream *stream, const uint8_t *data, uint16_t len,
+                     uint64_t time_us)
+{
+    hid_stream_update_stats(stream, time_us);
+
+    uint32_t head = stream->head;
+    if (head - stream->tail >= HID_STREAM_RING_SIZE) {
+        stream->num_dropped++;
+        return false;
+    }
+
+    HidStreamReport *report = &stream->ring[head % HID_STREAM_RING_SIZE];
+    report->time_us = time_us;
+    report->len = len;
+    memcpy(report->data, data,
+           len < HID_STREAM_MAX_REPORT_SIZE ? len : HID_STREAM_MAX_REPORT_SIZE);
+    /* Publish the report only once it has been written */
+    stream->head = head + 1;
+    return true;
+}
+
+bool hid_stream_pop(HidStream *stream, HidStreamReport *report)
+{
+    uint32_t tail = stream->tail;
+    if (tail == stream->head) return false;
+
+    *report = stream->ring[tail % HID_STREAM_RING_SIZE];
+    stream->tail = tail + 1;
+    return true;
+}
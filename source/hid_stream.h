@@ -0,0 +1,57 @@
+#ifndef BTT_HID_STREAM_H
+#define BTT_HID_STREAM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Input reports received on the HID interrupt channel. The Bluetooth
+ * callback pushes them, with their arrival time, into a fixed-size ring
+ * which the main loop drains; the arrival statistics are updated as they
+ * are pushed, so that they are not skewed by how often the ring is read.
+ */
+
+#define HID_STREAM_MAX_REPORT_SIZE 64
+#define HID_STREAM_RING_SIZE 32 /* must be a power of two */
+/* Statistics are published once per window */
+#define HID_STREAM_WINDOW_US 1000000
+
+typedef struct {
+    uint64_t time_us;
+    uint16_t len; /* may be larger than the data kept */
+    uint8_t data[HID_STREAM_MAX_REPORT_SIZE];
+} HidStreamReport;
+
+typedef struct {
+    uint32_t reports_per_sec;
+    uint32_t min_interval_us;
+    uint32_t max_interval_us;
+    /* Smoothed variation of the interval between reports, as in RFC 3550 */
+    uint32_t jitter_us;
+} HidStreamStats;
+
+typedef struct {
+    HidStreamReport ring[HID_STREAM_RING_SIZE];
+    volatile uint32_t head; /* only written by hid_stream_push() */
+    volatile uint32_t tail; /* only written by hid_stream_pop() */
+    uint32_t num_reports;
+    uint32_t num_dropped; /* the ring was full */
+    /* Current window */
+    uint64_t last_time_us;
+    uint32_t last_interval_us;
+    uint64_t window_start_us;
+    uint32_t window_reports;
+    uint32_t window_min_us;
+    uint32_t window_max_us;
+    uint32_t jitter; /* in 1/16 us */
+    HidStreamStats stats;
+} HidStream;
+
+void hid_stream_init(HidStream *stream);
+/* Returns false if the report was dropped because the ring is full */
+bool hid_stream_push(HidStream *stream, const uint8_t *data, uint16_t len,
+                     uint64_t time_us);
+/* Returns false if the ring is empty */
+bool hid_stream_pop(HidStream *stream, HidStreamReport *report);
+
+#endif // BTT_HID_STREAM_H
@@ -1,9 +1,19 @@
 #include "bluetooth.h"
 #include "bluetooth_sdp.h"
 #include "btstack_util.h"
+#include "hid_dispatch.h"
+#include "hid_layout.h"
+#include "hid_layout_cache.h"
+#include "hid_output.h"
+#include "hid_stream.h"
+#include "sdp_cache.h"
+#include "sdp_client.h"
+#include "sdp_export.h"
+#include "sdp_record.h"
 #include "sdp_util.h"
 
 #include <gccore.h>
+#include <ogc/lwp_watchdog.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -25,6 +35,7 @@ typedef enum {
     SCREEN_CONNECT,
     SCREEN_SDP,
     SCREEN_SDP_HID,
+    SCREEN_SDP_IDENTIFY,
     SCREEN_HID,
     SCREEN_PAIR,
     SCREEN_LAST,
@@ -102,12 +113,17 @@ typedef enum {
     CONN_STATUS_DISCONNECTED = 0,
     CONN_STATUS_CONNECTING,
     CONN_STATUS_CONNECTED,
+    CONN_STATUS_SDP_RECORD_STATE,
     CONN_STATUS_SDP_HID_SERVICE,
     CONN_STATUS_SDP_HID_ATTRIBUTES,
     CONN_STATUS_SDP_BROWSE_COMPLETE,
     CONN_STATUS_NULL_RESPONSE,
 } ConnectionStatus;
 
+#define SDP_MAX_RECORDS_INFO 8
+#define HID_MAX_VALUES 64
+/* Header of the reports sent by the device on the interrupt channel */
+#define HID_TRANS_DATA_INPUT 0xa1
 typedef struct {
     DeviceEntry device;
     int item_index;
@@ -116,12 +132,51 @@ typedef struct {
     int error_code;
     int l2cap_status;
     BtL2capHandle *sdp_handle;
+    SdpClient sdp_client;
     bool has_pending_call;
     int sdp_num_responses;
-    uint8_t sdp_response[4096];
+    uint8_t sdp_continuation_len;
+    uint16_t sdp_error;
+    uint8_t sdp_pattern[SDP_SERVICE_SEARCH_PATTERN_MAX_SIZE];
+    /* Attributes asked by the browse */
+    const SdpAttributeRange *sdp_attributes;
+    int sdp_num_attributes;
+    uint16_t sdp_cache_uuid; /* 0 if the response is not cached */
+    bool sdp_cache_loaded; /* a cached response was found */
+    SdpStore sdp_response;
+    SdpStore sdp_records; /* handles found by a ServiceSearch */
+    SdpStore sdp_states; /* handle and state of the records */
+    SdpStore sdp_cached_states;
+    bool sdp_from_cache;
+    bool sdp_cache_pending; /* the response should be saved */
+    bool sdp_states_pending; /* fetched alongside, only to save the cache */
+    bool sdp_extract_pending; /* the records should be extracted */
+    const char *sdp_export_status;
+    SdpRowIndex sdp_index;
+    SdpLineCache sdp_lines;
+    /* Extracted once the response is complete */
+    SdpRecordInfo sdp_records_info[SDP_MAX_RECORDS_INFO];
+    int sdp_num_records_info;
+    /* Compiled from the report descriptor of the first HID record */
+    HidLayout hid_layout;
+    bool has_hid_layout;
+    HidDispatch hid_dispatch; /* built from hid_layout, if there is one */
+    HidOutput hid_output;
+    /* The output or feature field changed by +/-, -1 if there is none */
+    int hid_output_field;
+    int32_t hid_output_value;
+    BtL2capHandle *hid_ctrl_handle;
+    BtL2capHandle *hid_intr_handle;
+    HidStream hid_stream;
+    /* The last report read from the stream */
+    HidStreamReport hid_report;
+    bool has_hid_report;
+    HidValue hid_values[HID_MAX_VALUES];
+    int hid_num_values;
+    /* Reports rejected by the dispatch table: unknown ID or wrong size */
+    uint32_t hid_num_rejected;
     uint16_t sdp_num_services;
     uint32_t sdp_hid_service_id;
-    int sdp_response_len;
     int num_link_key_requests;
     int num_link_key_notifications;
     int num_pin_code_requests;
@@ -131,15 +186,13 @@ typedef struct {
 
 static DeviceData s_device_data;
 static ListenData s_listen_data;
-static uint16_t s_sdp_transaction_id = 0;
-static uint8_t s_sdp_continuation_len = 0;
-static uint8_t s_sdp_continuation_code[16];
 static bool s_sdp_dump_raw = false;
 
 static const ActionItem s_device_actions[] = {
     { SCREEN_CONNECT, "Connect", },
     { SCREEN_SDP, "Read SDP data", },
     { SCREEN_SDP_HID, "Read SDP HID data", },
+    { SCREEN_SDP_IDENTIFY, "Quick identify", },
     { SCREEN_HID, "Run HID test", },
     { SCREEN_PAIR, "Pair device", },
 };
@@ -600,6 +653,12 @@ static void screen_listen_process_input(u32 buttons, u32 held)
 static void screen_device_reset()
 {
     DeviceData *data = &s_device_data;
+    sdp_row_index_clear(&data->sdp_index);
+    sdp_line_cache_clear(&data->sdp_lines);
+    sdp_store_clear(&data->sdp_response);
+    sdp_store_clear(&data->sdp_records);
+    sdp_store_clear(&data->sdp_states);
+    sdp_store_clear(&data->sdp_cached_states);
     memset(data, 0, sizeof(*data));
 
     const SearchDeviceData *search_data = &s_search_device_data;
@@ -716,203 +775,172 @@ static void screen_connect_process_input(u32 buttons, u32 held)
     }
 }
 
-static inline bool copy_response(const uint8_t *response, int size,
-                                 uint8_t *dest, int *dest_len, int dest_max_len)
-{
-    int available = dest_max_len - *dest_len;
-    bool did_fit = true;
-    if (size > available) {
-        size = available;
-        did_fit = false;
-    }
-    memcpy(dest + *dest_len, response, size);
-    *dest_len += size;
-    return did_fit;
-}
+/* Requests sent to the SDP server before its first response arrives */
+#define SDP_MAX_OUTSTANDING_REQUESTS 4
 
-/* Returns true if the response needs completion */
-static bool sdp_save_service_attribute(const uint8_t *response, int size,
-                                       uint8_t *dest, int *dest_len, int dest_max_len)
-{
-    int offset = 3; /* command ID + transaction ID */
+static const SdpAttributeRange s_sdp_all_attributes[] = {
+    { 0x0000, 0xffff },
+};
 
-    if (offset + 2 + 2 > size) return false;  // parameterLength, attributeListByteCount
+/* ServiceRecordHandle and ServiceRecordState: enough to tell whether the
+ * records changed since they were cached */
+static const SdpAttributeRange s_sdp_state_attributes[] = {
+    { BLUETOOTH_ATTRIBUTE_SERVICE_RECORD_HANDLE,
+      BLUETOOTH_ATTRIBUTE_SERVICE_RECORD_HANDLE },
+    { BLUETOOTH_ATTRIBUTE_SERVICE_RECORD_STATE,
+      BLUETOOTH_ATTRIBUTE_SERVICE_RECORD_STATE },
+};
 
-    uint16_t parameter_length = big_endian_read_16(response, offset);
-    offset += 2;
-    if (offset + parameter_length > size) return false;
+/* ServiceClassIDList, ServiceName and the 0x0200-0x0210 range, which holds
+ * the Device ID attributes of PnP Information records and the HID
+ * attributes of HID records */
+static const SdpAttributeRange s_sdp_identify_attributes[] = {
+    { BLUETOOTH_ATTRIBUTE_SERVICE_CLASS_ID_LIST,
+      BLUETOOTH_ATTRIBUTE_SERVICE_CLASS_ID_LIST },
+    { 0x0100, 0x0100 },
+    { 0x0200, 0x0210 },
+};
 
-    uint16_t attribute_list_size = big_endian_read_16(response, offset);
-    offset += 2;
-    if (!copy_response(response + offset, attribute_list_size,
-                       dest, dest_len, dest_max_len)) return false;
-    offset += attribute_list_size;
-    if (offset + 1 > size) return false; /* 1 byte for continuation state */
+static const SdpAttributeRange s_sdp_hid_attributes[] = {
+    { BLUETOOTH_ATTRIBUTE_SERVICE_CLASS_ID_LIST,
+      BLUETOOTH_ATTRIBUTE_SERVICE_CLASS_ID_LIST },
+    { BLUETOOTH_ATTRIBUTE_BLUETOOTH_PROFILE_DESCRIPTOR_LIST,
+      BLUETOOTH_ATTRIBUTE_BLUETOOTH_PROFILE_DESCRIPTOR_LIST },
+    { BLUETOOTH_ATTRIBUTE_HID_DEVICE_RELEASE_NUMBER, 0x0210 },
+};
 
-    uint8_t continuation_len = response[offset++];
-    if (continuation_len == 0 ||
-        continuation_len > 16 ||
-        offset + continuation_len > size) return false;
+#define SDP_NUM_RANGES(ranges) (sizeof(ranges) / sizeof(ranges[0]))
 
-    memcpy(s_sdp_continuation_code, response + offset, continuation_len);
-    s_sdp_continuation_len = continuation_len;
-    return true;
+static bool sdp_cache_is_current(DeviceData *data)
+{
+    return data->sdp_cached_states.len > 0 &&
+        sdp_store_equal(&data->sdp_states, &data->sdp_cached_states) &&
+        sdp_cache_states_usable(&data->sdp_states);
 }
 
-static int sdp_build_service_search_req(uint8_t *buffer, uint16_t attribute)
+/* Loads the cached response, to be used if the records did not change */
+static void sdp_load_cache(DeviceData *data, uint16_t uuid)
 {
-    int len = 0;
-
-    buffer[len++] = SDP_ServiceSearchRequest;
-    big_endian_store_16(buffer, len, s_sdp_transaction_id++);
-    len += 2;
-
-    /* parameters length, we'll fill it later */
-    len += 2;
-
-    const uint8_t *search_pattern = sdp_service_search_pattern_for_uuid16(attribute);
-    uint16_t search_pattern_len = de_get_len(search_pattern);
-    memcpy(buffer + len, search_pattern, search_pattern_len);
-    len += search_pattern_len;
-
-    //     MaximumAttributeByteCount - uint16_t  0x0007 - 0xffff -> mtu
-    big_endian_store_16(buffer, len, 0x3);
-    len += 2;
-
-    //     ContinuationState - uint8_t number of cont. bytes N<=16
-    buffer[len++] = 0;
-
-    // uint16_t paramLength
-    big_endian_store_16(buffer, 3, len - 5);
-    return len;
+    data->sdp_cache_uuid = uuid;
+    data->sdp_from_cache = false;
+    data->sdp_cache_pending = false;
+    data->sdp_states_pending = false;
+    sdp_store_reset(&data->sdp_response);
+    sdp_store_reset(&data->sdp_states);
+    sdp_store_reset(&data->sdp_cached_states);
+    data->sdp_cache_loaded =
+        sdp_cache_load(data->device.bdaddr, uuid,
+                       &data->sdp_cached_states, &data->sdp_response);
 }
 
-static int sdp_build_service_attribute_req(uint8_t *buffer,
-                                           uint32_t service_id,
-                                           uint16_t attribute)
+/* Called from the main loop: files are not written from the callbacks */
+static void sdp_save_cache(DeviceData *data)
 {
-    int len = 0;
-
-    buffer[len++] = SDP_ServiceAttributeRequest;
-    big_endian_store_16(buffer, len, s_sdp_transaction_id++);
-    len += 2;
+    if (!data->sdp_cache_pending) return;
 
-    /* parameters length, we'll fill it later */
-    len += 2;
-
-    big_endian_store_32(buffer, len, service_id);
-    len += 4;
-
-    //     MaximumAttributeByteCount - uint16_t  0x0007 - 0xffff -> mtu
-    big_endian_store_16(buffer, len, 4096);
-    len += 2;
-
-    /* AttibuteIDList (all) */
-    static const uint8_t attribute_id_list[] = {0x35, 0x05, 0x0A, 0x00, 0x00, 0xff, 0xff};
-    uint16_t attribute_id_list_len = de_get_len(attribute_id_list);
-    memcpy(buffer + len, attribute_id_list, attribute_id_list_len);
-    len += attribute_id_list_len;
-
-    //     ContinuationState - uint8_t number of cont. bytes N<=16
-    buffer[len++] = s_sdp_continuation_len;
-    if (s_sdp_continuation_len > 0) {
-        memcpy(buffer + len, s_sdp_continuation_code, s_sdp_continuation_len);
-        len += s_sdp_continuation_len;
+    data->sdp_cache_pending = false;
+    if (sdp_cache_states_usable(&data->sdp_states)) {
+        sdp_cache_save(data->device.bdaddr, data->sdp_cache_uuid,
+                       &data->sdp_states, &data->sdp_response);
     }
-
-    // uint16_t paramLength
-    big_endian_store_16(buffer, 3, len - 5);
-    return len;
 }
 
-/* Returns true if the response needs completion */
-static bool sdp_save_search_attribute(const uint8_t *response, int size,
-                                      uint8_t *dest, int *dest_len, int dest_max_len)
+/* Called from the main loop, like sdp_save_cache(): the response is walked
+ * by offset, without flattening it */
+static void sdp_extract_records(DeviceData *data)
 {
-    int offset = 3; /* command ID + transaction ID */
-
-    if (offset + 2 + 2 > size) return false;  // parameterLength, attributeListByteCount
-
-    uint16_t parameter_length = big_endian_read_16(response, offset);
-    offset += 2;
-    if (offset + parameter_length > size) return false;
-
-    uint16_t attribute_list_size = big_endian_read_16(response, offset);
-    offset += 2;
-    if (!copy_response(response + offset, attribute_list_size,
-                       dest, dest_len, dest_max_len)) return false;
-    offset += attribute_list_size;
-    if (offset + 1 > size) return false; /* 1 byte for continuation state */
+    if (!data->sdp_extract_pending) return;
 
-    uint8_t continuation_len = response[offset++];
-    if (continuation_len == 0 ||
-        continuation_len > 16 ||
-        offset + continuation_len > size) return false;
+    data->sdp_extract_pending = false;
+    queue_refresh();
+    /* Validated once here, so that later walks over the response (the
+     * views, the export) can skip the checks */
+    bool trusted = de_validate_store(&data->sdp_response);
+    data->sdp_num_records_info =
+        sdp_records_extract(&data->sdp_response, trusted,
+                            data->sdp_records_info, SDP_MAX_RECORDS_INFO);
+    if (data->sdp_num_records_info > SDP_MAX_RECORDS_INFO) {
+        data->sdp_num_records_info = SDP_MAX_RECORDS_INFO;
+    }
 
-    memcpy(s_sdp_continuation_code, response + offset, continuation_len);
-    s_sdp_continuation_len = continuation_len;
-    return true;
+    data->has_hid_layout = false;
+    for (int i = 0; i < data->sdp_num_records_info; i++) {
+        const SdpHidInfo *hid = &data->sdp_records_info[i].hid;
+        if (!data->sdp_records_info[i].is_hid ||
+            hid->report_descriptor_len == 0) continue;
+        /* Only this one string needs to be contiguous */
+        const uint8_t *descriptor =
+            sdp_store_get(&data->sdp_response, hid->report_descriptor_offset,
+                          hid->report_descriptor_len);
+        if (!descriptor) break;
+        /* Only compiled if no device has sent this descriptor before */
+        data->has_hid_layout =
+            hid_layout_cache_get(&data->hid_layout, data->device.bdaddr,
+                                 descriptor, hid->report_descriptor_len);
+        break;
+    }
 }
 
-static int sdp_build_search_attribute_req(uint8_t *buffer, uint16_t attribute)
+static void sdp_response_cb(SdpClient *client, const SdpClientResult *result,
+                            void *cb_data)
 {
-    int len = 0;
-
-    buffer[len++] = SDP_ServiceSearchAttributeRequest;
-    big_endian_store_16(buffer, len, s_sdp_transaction_id++);
-    len += 2;
-
-    /* parameters length, we'll fill it later */
-    len += 2;
-
-    const uint8_t *search_pattern = sdp_service_search_pattern_for_uuid16(attribute);
-    uint16_t search_pattern_len = de_get_len(search_pattern);
-    memcpy(buffer + len, search_pattern, search_pattern_len);
-    len += search_pattern_len;
-
-    //     MaximumAttributeByteCount - uint16_t  0x0007 - 0xffff -> mtu
-    big_endian_store_16(buffer, len, 0xffff);
-    len += 2;
-
-    /* AttibuteIDList (all) */
-    static const uint8_t attribute_id_list[] = {0x35, 0x05, 0x0A, 0x00, 0x00, 0xff, 0xff};
-    uint16_t attribute_id_list_len = de_get_len(attribute_id_list);
-    memcpy(buffer + len, attribute_id_list, attribute_id_list_len);
-    len += attribute_id_list_len;
-
-    //     ContinuationState - uint8_t number of cont. bytes N<=16
-    buffer[len++] = s_sdp_continuation_len;
-    if (s_sdp_continuation_len > 0) {
-        memcpy(buffer + len, s_sdp_continuation_code, s_sdp_continuation_len);
-        len += s_sdp_continuation_len;
-    }
+    DeviceData *data = cb_data;
 
-    // uint16_t paramLength
-    big_endian_store_16(buffer, 3, len - 5);
-    return len;
+    queue_refresh();
+    data->sdp_num_responses++;
+    data->sdp_continuation_len = result->continuation_len;
+    if (!result->complete) return;
+
+    data->sdp_error = result->error_code;
+    data->has_pending_call = false;
+    /* If the states are still on their way, they save the response */
+    data->sdp_cache_pending = data->sdp_cache_uuid != 0 &&
+        !data->sdp_states_pending && result->error_code == 0;
+    data->sdp_extract_pending = true;
+    data->conn_status = CONN_STATUS_SDP_BROWSE_COMPLETE;
+    set_animating(false);
 }
 
-static void sdp_got_message(BtL2capHandle *handle, void *msg, size_t len,
-                            void *cb_data)
+static void sdp_states_cb(SdpClient *client, const SdpClientResult *result,
+                          void *cb_data)
 {
     DeviceData *data = cb_data;
 
     queue_refresh();
     data->sdp_num_responses++;
+    if (!result->complete) return;
 
-    bool cont = sdp_save_search_attribute(msg, len,
-                                          data->sdp_response, &data->sdp_response_len,
-                                          sizeof(data->sdp_response));
-    if (cont) {
-        uint8_t buffer[256];
-        int len = sdp_build_search_attribute_req(buffer,
-                                  BLUETOOTH_PROTOCOL_L2CAP);
-        bt_l2cap_handle_write(handle, buffer, len);
-    } else {
+    if (sdp_cache_is_current(data)) {
+        data->sdp_from_cache = true;
         data->has_pending_call = false;
+        data->sdp_extract_pending = true;
         data->conn_status = CONN_STATUS_SDP_BROWSE_COMPLETE;
         set_animating(false);
+        return;
     }
+
+    sdp_store_reset(&data->sdp_response);
+    data->sdp_num_responses = 0;
+    data->conn_status = CONN_STATUS_CONNECTED;
+    sdp_client_service_search_attribute(client, data->sdp_pattern,
+                                        data->sdp_attributes,
+                                        data->sdp_num_attributes,
+                                        &data->sdp_response,
+                                        sdp_response_cb, data);
+}
+
+/* The states of a response which was not in the cache yet */
+static void sdp_states_to_save_cb(SdpClient *client,
+                                  const SdpClientResult *result, void *cb_data)
+{
+    DeviceData *data = cb_data;
+
+    if (!result->complete) return;
+
+    data->sdp_states_pending = false;
+    data->sdp_cache_pending =
+        data->conn_status == CONN_STATUS_SDP_BROWSE_COMPLETE &&
+        data->sdp_error == 0;
 }
 
 static void sdp_connect_cb(const BtConnectResult *result, void *cb_data)
@@ -923,41 +951,100 @@ static void sdp_connect_cb(const BtConnectResult *result, void *cb_data)
 
     data->error_code = result->error_code;
     data->l2cap_status = result->status;
-    if (result->error_code == 0) {
-        data->conn_status = CONN_STATUS_CONNECTED;
-    } else {
+    if (result->error_code != 0) {
         data->conn_status = CONN_STATUS_DISCONNECTED;
         set_animating(false);
         return;
     }
-    BtL2capHandle *handle = data->sdp_handle = result->handle;
-
-    bt_l2cap_handle_notify(handle, sdp_got_message, data);
-
-    uint8_t buffer[256];
-    int len = sdp_build_search_attribute_req(buffer,
-                            BLUETOOTH_PROTOCOL_L2CAP);
-    bt_l2cap_handle_write(handle, buffer, len);
+    data->sdp_handle = result->handle;
+    SdpClient *client = &data->sdp_client;
+    sdp_client_init(client, result->handle, SDP_MAX_OUTSTANDING_REQUESTS);
+
+    if (data->sdp_cache_loaded) {
+        /* Check first if the cached response is still current */
+        data->conn_status = CONN_STATUS_SDP_RECORD_STATE;
+        sdp_client_service_search_attribute(client, data->sdp_pattern,
+                                            s_sdp_state_attributes,
+                                            SDP_NUM_RANGES(s_sdp_state_attributes),
+                                            &data->sdp_states,
+                                            sdp_states_cb, data);
+    } else {
+        data->conn_status = CONN_STATUS_CONNECTED;
+        if (data->sdp_cache_uuid != 0) {
+            /* Nothing to check, but the states are needed to save the
+             * response: they are asked in the same go */
+            data->sdp_states_pending = true;
+            sdp_client_service_search_attribute(client, data->sdp_pattern,
+                                                s_sdp_state_attributes,
+                                                SDP_NUM_RANGES(s_sdp_state_attributes),
+                                                &data->sdp_states,
+                                                sdp_states_to_save_cb, data);
+        }
+        sdp_client_service_search_attribute(client, data->sdp_pattern,
+                                            data->sdp_attributes,
+                                            data->sdp_num_attributes,
+                                            &data->sdp_response,
+                                            sdp_response_cb, data);
+    }
 }
 
-static void screen_sdp_reset()
+/* Starts a ServiceSearchAttribute browse with the pattern and attributes
+ * set up in data; sdp_response holds the cached response, if any */
+static void sdp_browse_start(DeviceData *data)
 {
-    DeviceData *data = &s_device_data;
-
-    s_sdp_continuation_len = 0;
-    s_sdp_transaction_id = 0;
     data->current_row = 0;
     data->error_code = 0;
     data->l2cap_status = 0;
     data->conn_status = CONN_STATUS_CONNECTING;
     data->sdp_num_responses = 0;
-    data->sdp_response_len = 0;
+    data->sdp_continuation_len = 0;
+    data->sdp_error = 0;
+    data->sdp_num_records_info = 0;
+    data->sdp_extract_pending = false;
+    data->has_hid_layout = false;
+    data->sdp_export_status = NULL;
+    sdp_row_index_clear(&data->sdp_index);
+    sdp_line_cache_clear(&data->sdp_lines);
     data->has_pending_call = true;
     set_animating(true);
     bt_connect(data->device.bdaddr, true, BT_PSM_SDP,
                sdp_connect_cb, data);
 }
 
+static void screen_sdp_reset()
+{
+    DeviceData *data = &s_device_data;
+    uint16_t uuid = BLUETOOTH_PROTOCOL_L2CAP;
+
+    sdp_service_search_pattern_build(data->sdp_pattern, sizeof(data->sdp_pattern),
+                                     &uuid, 1, NULL, 0);
+    data->sdp_attributes = s_sdp_all_attributes;
+    data->sdp_num_attributes = SDP_NUM_RANGES(s_sdp_all_attributes);
+    sdp_load_cache(data, uuid);
+    sdp_browse_start(data);
+}
+
+static void screen_sdp_identify_reset()
+{
+    DeviceData *data = &s_device_data;
+    /* Records match only if they contain all the UUIDs of the pattern, so
+     * the HID, PnP Information and Device ID records can only be fetched
+     * together through the L2CAP UUID which they all share */
+    uint16_t uuid = BLUETOOTH_PROTOCOL_L2CAP;
+
+    sdp_service_search_pattern_build(data->sdp_pattern, sizeof(data->sdp_pattern),
+                                     &uuid, 1, NULL, 0);
+    data->sdp_attributes = s_sdp_identify_attributes;
+    data->sdp_num_attributes = SDP_NUM_RANGES(s_sdp_identify_attributes);
+    data->sdp_cache_uuid = 0;
+    data->sdp_cache_loaded = false;
+    data->sdp_from_cache = false;
+    data->sdp_cache_pending = false;
+    data->sdp_states_pending = false;
+    sdp_store_reset(&data->sdp_response);
+    sdp_browse_start(data);
+}
+
 static void screen_sdp_pop()
 {
     DeviceData *data = &s_device_data;
@@ -966,6 +1053,75 @@ static void screen_sdp_pop()
         bt_l2cap_handle_close(data->sdp_handle);
         data->sdp_handle = NULL;
     }
+    sdp_client_reset(&data->sdp_client);
+    sdp_row_index_clear(&data->sdp_index);
+    sdp_line_cache_clear(&data->sdp_lines);
+    sdp_store_clear(&data->sdp_response);
+    sdp_store_clear(&data->sdp_records);
+    sdp_store_clear(&data->sdp_states);
+    sdp_store_clear(&data->sdp_cached_states);
+}
+
+static void print_sdp_response(DeviceData *data, bool complete, int max_rows)
+{
+    SdpLineCache *lines = &data->sdp_lines;
+    SdpRowIndex *index = &data->sdp_index;
+    /* Fragments are appended by the L2CAP callback */
+    int response_len = data->sdp_response.len;
+
+    if (s_sdp_dump_raw) {
+        printf("Got response size %d\n", response_len);
+        max_rows--;
+    }
+
+    /* Render each element once, as soon as it has been received, then only
+     * copy the rows which fit on the screen */
+    if (!complete) {
+        sdp_line_cache_feed(lines, &data->sdp_response, response_len,
+                            s_sdp_dump_raw);
+        if (lines->valid) {
+            sdp_line_cache_print(lines, data->current_row, max_rows);
+        }
+        return;
+    }
+
+    sdp_line_cache_finish(lines, &data->sdp_response, response_len,
+                          s_sdp_dump_raw);
+    if (lines->valid) {
+        sdp_line_cache_print(lines, data->current_row, max_rows);
+        return;
+    }
+
+    /* Not enough memory for the text: index the rows instead */
+    if (!index->built || index->raw != s_sdp_dump_raw) {
+        sdp_row_index_build(index, &data->sdp_response,
+                            response_len, s_sdp_dump_raw);
+    }
+    sdp_row_index_print(index, &data->sdp_response, data->current_row, max_rows);
+}
+
+static int sdp_response_num_rows(const DeviceData *data)
+{
+    if (data->sdp_lines.valid) return data->sdp_lines.num_lines;
+    if (data->sdp_index.built) return data->sdp_index.num_rows;
+    return -1;
+}
+
+static void scroll_sdp_response(DeviceData *data, u32 buttons, u32 held)
+{
+    int num_rows = sdp_response_num_rows(data);
+
+    if ((buttons | held) & WPAD_BUTTON_LEFT) {
+        if (num_rows < 0 || data->current_row + 1 < num_rows) {
+            queue_refresh();
+            data->current_row++;
+        }
+    } else if ((buttons | held) & WPAD_BUTTON_RIGHT) {
+        if (data->current_row > 0) {
+            queue_refresh();
+            data->current_row--;
+        }
+    }
 }
 
 static void print_row_data(char *data, int len)
@@ -994,6 +1150,41 @@ static void print_data(const void *data, int len)
     }
 }
 
+/* Returns the number of rows printed */
+static int print_sdp_summary(const DeviceData *data)
+{
+    int rows = 0;
+
+    for (int i = 0; i < data->sdp_num_records_info; i++) {
+        const SdpRecordInfo *info = &data->sdp_records_info[i];
+        if (info->is_pnp) {
+            printf("PnP: vendor 0x%04x (source %d), product 0x%04x, version 0x%04x\n",
+                   info->pnp.vendor_id, info->pnp.vendor_id_source,
+                   info->pnp.product_id, info->pnp.version);
+            rows++;
+        } else if (info->is_hid) {
+            printf("HID: parser 0x%04x, subclass 0x%02x, country %d, "
+                   "report descriptor %d bytes\n",
+                   info->hid.parser_version, info->hid.subclass,
+                   info->hid.country_code, info->hid.report_descriptor_len);
+            rows++;
+        }
+    }
+
+    if (data->has_hid_layout) {
+        const HidLayout *layout = &data->hid_layout;
+        int counts[HID_REPORT_NUM_TYPES] = { 0 };
+        for (int i = 0; i < layout->num_fields; i++) {
+            counts[layout->fields[i].type]++;
+        }
+        printf("HID fields: %d input, %d output, %d feature%s\n",
+               counts[HID_REPORT_INPUT], counts[HID_REPORT_OUTPUT],
+               counts[HID_REPORT_FEATURE], layout->truncated ? " (truncated)" : "");
+        rows++;
+    }
+    return rows;
+}
+
 static void screen_sdp_draw()
 {
     const DeviceData *data = &s_device_data;
@@ -1001,7 +1192,9 @@ static void screen_sdp_draw()
     printf(CONSOLE_RESET "\x1b[2;0H" CONSOLE_YELLOW);
     char bdaddr[20];
     sprintf_bdaddr(bdaddr, data->device.bdaddr);
-    printf("SDP TO %s - %.64s", bdaddr, data->device.name);
+    printf("%s %s - %.64s",
+           current_screen_id() == SCREEN_SDP_IDENTIFY ? "IDENTIFY" : "SDP TO",
+           bdaddr, data->device.name);
 
     printf(CONSOLE_WHITE);
     printf("\x1b[4;0H");
@@ -1013,138 +1206,209 @@ static void screen_sdp_draw()
     } else if (data->conn_status == CONN_STATUS_DISCONNECTED) {
         printf("Disconnected     \n");
         printf("Error code = %d, status = %d\n", data->error_code, data->l2cap_status);
+    } else if (data->conn_status == CONN_STATUS_SDP_RECORD_STATE) {
+        printf("Connected.\n");
+        printf("Checking service records... %c\n", anim_char);
     } else if (data->conn_status == CONN_STATUS_CONNECTED) {
         printf("Connected.\n");
         printf("Browsing SDP services... %c (%d resp, cont len=%d)\n", anim_char,
-               data->sdp_num_responses, s_sdp_continuation_len);
+               data->sdp_num_responses, data->sdp_continuation_len);
+        print_sdp_response(&s_device_data, false, 18);
     } else if (data->conn_status == CONN_STATUS_SDP_BROWSE_COMPLETE) {
-        printf("Got response, size = %d\n", data->sdp_response_len);
-        if (s_sdp_dump_raw) {
-            printf("Got response size %d\n", data->sdp_response_len);
-            de_dump_data_element(data->sdp_response, data->current_row, 18);
-        } else {
-            sdp_print_attribute_list(data->sdp_response, data->current_row, 19);
+        printf("Got response, size = %d%s%s\n", (int)data->sdp_response.len,
+               data->sdp_from_cache ? " (cached)" : "",
+               data->sdp_error == SDP_CLIENT_ERROR_NO_SPACE ? " (truncated)" : "");
+        int rows = 0;
+        if (current_screen_id() == SCREEN_SDP_IDENTIFY) {
+            rows = print_sdp_summary(data);
         }
+        print_sdp_response(&s_device_data, true, 19 - rows);
     }
 
     printf(CONSOLE_WHITE CONSOLE_RESET "\x1b[%d;0H", s_screen_h - 4);
     printf("_________________________________\n");
     printf(CONSOLE_WHITE "1 - " CONSOLE_RESET "Back  ");
+    if (data->conn_status == CONN_STATUS_SDP_BROWSE_COMPLETE) {
+        printf(CONSOLE_WHITE "2 - " CONSOLE_RESET "Export to SD  ");
+        if (data->sdp_export_status) printf("%s", data->sdp_export_status);
+    }
+}
+
+/* Writes the response both as JSON and as CBOR */
+static void sdp_export_response(DeviceData *data)
+{
+    /* Partial responses, such as the quick identify one, have no UUID of
+     * their own: they are saved as 0000, next to the full ones */
+    uint16_t uuid = data->sdp_cache_uuid;
+    bool ok =
+        sdp_export_save(data->device.bdaddr, uuid, &data->sdp_response,
+                        SDP_EXPORT_JSON) &&
+        sdp_export_save(data->device.bdaddr, uuid, &data->sdp_response,
+                        SDP_EXPORT_CBOR);
+    data->sdp_export_status = ok ? "Exported." : "Export failed.";
 }
 
 static void screen_sdp_process_input(u32 buttons, u32 held)
 {
     DeviceData *data = &s_device_data;
+    sdp_extract_records(data);
+    sdp_save_cache(data);
+    hid_layout_cache_save();
     if (buttons & WPAD_BUTTON_1) {
         pop_screen();
+    } else if (buttons & WPAD_BUTTON_2) {
+        if (data->conn_status == CONN_STATUS_SDP_BROWSE_COMPLETE) {
+            queue_refresh();
+            sdp_export_response(data);
+        }
     } else if (buttons & WPAD_BUTTON_A) {
         queue_refresh();
         s_sdp_dump_raw = !s_sdp_dump_raw;
-    } else if ((buttons | held) & WPAD_BUTTON_LEFT) {
-        queue_refresh();
-        data->current_row++;
-    } else if ((buttons | held) & WPAD_BUTTON_RIGHT) {
-        if (data->current_row > 0) {
-            queue_refresh();
-            data->current_row--;
-        }
+        data->current_row = 0;
+    } else {
+        scroll_sdp_response(data, buttons, held);
     }
 }
 
-static void sdp_hid_got_message(BtL2capHandle *handle, void *message, size_t len,
-                                void *cb_data)
+static void sdp_hid_attributes_cb(SdpClient *client,
+                                  const SdpClientResult *result, void *cb_data)
 {
     DeviceData *data = cb_data;
-    const uint8_t *msg = message;
-    data->sdp_num_responses++;
 
     queue_refresh();
-    if (len <= 0) {
+    data->sdp_num_responses++;
+    data->sdp_continuation_len = result->continuation_len;
+    if (!result->complete) return;
+
+    data->sdp_error = result->error_code;
+    data->has_pending_call = false;
+    data->sdp_cache_pending = result->error_code == 0;
+    data->conn_status = CONN_STATUS_SDP_HID_ATTRIBUTES;
+    set_animating(false);
+}
+
+/* Called when either the record state or the service search completes: the
+ * two are requested together, and the first one to finish waits for the
+ * other */
+static void sdp_hid_search_done(SdpClient *client, DeviceData *data)
+{
+    if (sdp_client_num_pending(client) > 0) return;
+
+    if (data->sdp_error == SDP_CLIENT_ERROR_EMPTY) {
         data->conn_status = CONN_STATUS_NULL_RESPONSE;
         data->has_pending_call = false;
         set_animating(false);
         return;
     }
 
-    if (msg[0] == SDP_ServiceSearchResponse) {
-        data->conn_status = CONN_STATUS_SDP_HID_SERVICE;
-        if (len >= 9) {
-            data->sdp_num_services = big_endian_read_16(msg, 7);
-        } else {
-            data->sdp_num_services = 0;
-        }
+    if (sdp_cache_is_current(data)) {
+        data->sdp_from_cache = true;
+        data->has_pending_call = false;
+        data->conn_status = CONN_STATUS_SDP_HID_ATTRIBUTES;
+        set_animating(false);
+        return;
+    }
 
-        uint32_t service_id = 0;
-        if (data->sdp_num_services > 0 && len >= 9 + 4) {
-            service_id = big_endian_read_32(msg, 9);
-        }
-        data->sdp_hid_service_id = service_id;
-        data->sdp_response_len = 0;
-        data->sdp_num_responses = 0;
+    data->conn_status = CONN_STATUS_SDP_HID_SERVICE;
+    uint32_t service_id = 0;
+    const uint8_t *handle = sdp_store_get(&data->sdp_records, 0, 4);
+    if (handle) {
+        service_id = big_endian_read_32(handle, 0);
+    }
+    data->sdp_hid_service_id = service_id;
+    sdp_store_reset(&data->sdp_response);
+    data->sdp_num_responses = 0;
 
-        if (service_id != 0) {
-            uint8_t buffer[256];
-            s_sdp_continuation_len = 0;
-            int len = sdp_build_service_attribute_req(buffer, service_id,
-                                                      BLUETOOTH_ATTRIBUTE_HID_DESCRIPTOR_LIST);
+    if (service_id != 0) {
+        sdp_client_service_attribute(client, service_id, s_sdp_hid_attributes,
+                                     SDP_NUM_RANGES(s_sdp_hid_attributes),
+                                     &data->sdp_response,
+                                     sdp_hid_attributes_cb, data);
+    } else {
+        data->has_pending_call = false;
+        set_animating(false);
+    }
+}
 
-            bt_l2cap_handle_write(handle, buffer, len);
-        } else {
-            copy_response(msg, len, data->sdp_response, &data->sdp_response_len,
-                          sizeof(data->sdp_response));
-            data->has_pending_call = false;
-            set_animating(false);
-        }
-    } else if (msg[0] == SDP_ServiceAttributeResponse) {
-        bool cont = sdp_save_service_attribute(msg, len,
-                                               data->sdp_response, &data->sdp_response_len,
-                                               sizeof(data->sdp_response));
-        if (cont) {
-            uint8_t buffer[256];
-            int len = sdp_build_service_attribute_req(buffer, data->sdp_hid_service_id,
-                                                      BLUETOOTH_ATTRIBUTE_HID_DESCRIPTOR_LIST);
-            bt_l2cap_handle_write(handle, buffer, len);
-        } else {
-            data->has_pending_call = false;
-            data->conn_status = CONN_STATUS_SDP_HID_ATTRIBUTES;
-            set_animating(false);
-        }
+static void sdp_hid_states_cb(SdpClient *client, const SdpClientResult *result,
+                              void *cb_data)
+{
+    DeviceData *data = cb_data;
+
+    queue_refresh();
+    data->sdp_num_responses++;
+    if (!result->complete) return;
+
+    if (result->error_code == SDP_CLIENT_ERROR_EMPTY) {
+        data->sdp_error = result->error_code;
     }
+    sdp_hid_search_done(client, data);
 }
 
-static void sdp_hid_connect_cb(const BtConnectResult *result, void *cb_data)
+static void sdp_hid_service_cb(SdpClient *client, const SdpClientResult *result,
+                               void *cb_data)
 {
     DeviceData *data = cb_data;
 
     queue_refresh();
-    if (result->error_code == 0) {
-        data->conn_status = CONN_STATUS_CONNECTED;
-    } else {
-        data->conn_status = CONN_STATUS_DISCONNECTED;
+    data->sdp_num_responses++;
+    if (!result->complete) return;
+
+    data->sdp_num_services = result->total_records;
+    if (result->error_code != 0) {
+        data->sdp_error = result->error_code;
     }
-    data->error_code = result->error_code;
-    data->l2cap_status = result->status;
-    BtL2capHandle *handle = data->sdp_handle = result->handle;
+    sdp_hid_search_done(client, data);
+}
 
-    bt_l2cap_handle_notify(handle, sdp_hid_got_message, data);
+static void sdp_hid_connect_cb(const BtConnectResult *result, void *cb_data)
+{
+    DeviceData *data = cb_data;
 
-    uint8_t buffer[256];
-    int len = sdp_build_service_search_req(buffer, 0x1124);
+    queue_refresh();
+    data->error_code = result->error_code;
+    data->l2cap_status = result->status;
+    if (result->error_code != 0) {
+        data->conn_status = CONN_STATUS_DISCONNECTED;
+        data->has_pending_call = false;
+        set_animating(false);
+        return;
+    }
+    data->conn_status = CONN_STATUS_SDP_RECORD_STATE;
+    data->sdp_handle = result->handle;
+    SdpClient *client = &data->sdp_client;
+    sdp_client_init(client, result->handle, SDP_MAX_OUTSTANDING_REQUESTS);
 
-    bt_l2cap_handle_write(handle, buffer, len);
+    /* Whether the cached response, if any, is still current and which
+     * record to fetch otherwise are asked back-to-back */
+    sdp_client_service_search_attribute(client, data->sdp_pattern,
+                                        s_sdp_state_attributes,
+                                        SDP_NUM_RANGES(s_sdp_state_attributes),
+                                        &data->sdp_states,
+                                        sdp_hid_states_cb, data);
+    sdp_client_service_search(client, data->sdp_pattern, 3,
+                              &data->sdp_records, sdp_hid_service_cb, data);
 }
 
 static void screen_sdp_hid_reset()
 {
     DeviceData *data = &s_device_data;
 
-    s_sdp_transaction_id = 0;
     data->current_row = 0;
     data->error_code = 0;
     data->l2cap_status = 0;
     data->conn_status = CONN_STATUS_CONNECTING;
-    data->sdp_num_responses = false;
-    data->sdp_response_len = 0;
+    data->sdp_num_responses = 0;
+    data->sdp_continuation_len = 0;
+    data->sdp_error = 0;
+    data->sdp_num_services = 0;
+    sdp_store_reset(&data->sdp_records);
+    sdp_row_index_clear(&data->sdp_index);
+    sdp_line_cache_clear(&data->sdp_lines);
+    uint16_t uuid = BLUETOOTH_SERVICE_CLASS_HUMAN_INTERFACE_DEVICE_SERVICE;
+    sdp_service_search_pattern_build(data->sdp_pattern, sizeof(data->sdp_pattern),
+                                     &uuid, 1, NULL, 0);
+    sdp_load_cache(data, uuid);
     data->has_pending_call = true;
     set_animating(true);
     bt_connect(data->device.bdaddr, true, BT_PSM_SDP,
@@ -1178,6 +1442,9 @@ static void screen_sdp_hid_draw()
     } else if (data->conn_status == CONN_STATUS_DISCONNECTED) {
         printf("Disconnected     \n");
         printf("Error code = %d, status = %d\n", data->error_code, data->l2cap_status);
+    } else if (data->conn_status == CONN_STATUS_SDP_RECORD_STATE) {
+        printf("Connected.\n");
+        printf("Checking service records... %c            \n", anim_char);
     } else if (data->conn_status == CONN_STATUS_CONNECTED) {
         printf("Connected.\n");
         printf("Getting service ID... %c                  \n", anim_char);
@@ -1185,18 +1452,23 @@ static void screen_sdp_hid_draw()
         if (data->sdp_hid_service_id != 0) {
             printf("Got HID service: 0x%x\n", data->sdp_hid_service_id);
             printf("Getting attributes... %c (%d resp, cont len=%d)      \n", anim_char,
-                   data->sdp_num_responses, s_sdp_continuation_len);
+                   data->sdp_num_responses, data->sdp_continuation_len);
+            print_sdp_response(&s_device_data, false, 18);
         } else {
             printf("Error code = %d, status = %d\n", data->error_code, data->l2cap_status);
-            printf("Failed to get service ID (response length = %d).\n", data->sdp_response_len);
-            print_data(data->sdp_response, data->sdp_response_len);
+            printf("Failed to get service ID (SDP error = 0x%04x, %d records).\n",
+                   data->sdp_error, data->sdp_num_services);
+            uint8_t response[320];
+            int response_len = sdp_store_read(&data->sdp_records, 0,
+                                              response, sizeof(response));
+            print_data(response, response_len);
         }
     } else if (data->conn_status == CONN_STATUS_SDP_HID_ATTRIBUTES) {
-        if (s_sdp_dump_raw) {
-            printf("Got response size %d\n", data->sdp_response_len);
-            de_dump_data_element(data->sdp_response, data->current_row, 18);
+        if (data->sdp_error == SDP_CLIENT_ERROR_NO_SPACE) {
+            printf("Response truncated, size = %d\n", (int)data->sdp_response.len);
+            print_sdp_response(&s_device_data, true, 18);
         } else {
-            sdp_print_attribute_list(data->sdp_response, data->current_row, 19);
+            print_sdp_response(&s_device_data, true, 19);
         }
     } else if (data->conn_status == CONN_STATUS_NULL_RESPONSE) {
         printf("Error code = %d, status = %d\n", data->error_code, data->l2cap_status);
@@ -1211,20 +1483,36 @@ static void screen_sdp_hid_draw()
 static void screen_sdp_hid_process_input(u32 buttons, u32 held)
 {
     DeviceData *data = &s_device_data;
+    sdp_save_cache(data);
     if (buttons & WPAD_BUTTON_1) {
         pop_screen();
     } else if (buttons & WPAD_BUTTON_A) {
         queue_refresh();
         s_sdp_dump_raw = !s_sdp_dump_raw;
-    } else if ((buttons | held) & WPAD_BUTTON_LEFT) {
-        queue_refresh();
-        data->current_row++;
-    } else if ((buttons | held) & WPAD_BUTTON_RIGHT) {
-        if (data->current_row > 0) {
-            queue_refresh();
-            data->current_row--;
-        }
+        data->current_row = 0;
+    } else {
+        scroll_sdp_response(data, buttons, held);
+    }
+}
+
+static void hid_intr_notify_cb(BtL2capHandle *handle, void *buffer,
+                               size_t len, void *cb_data)
+{
+    DeviceData *data = cb_data;
+    const uint8_t *bytes = buffer;
+
+    if (len < 1 || bytes[0] != HID_TRANS_DATA_INPUT) return;
+
+    /* Malformed reports are dropped before they reach the stream */
+    if (data->has_hid_layout &&
+        !hid_dispatch_route(&data->hid_dispatch, bytes + 1, len - 1)) {
+        data->hid_num_rejected++;
+        return;
     }
+
+    /* Timestamped here, so that the statistics reflect the arrival times */
+    hid_stream_push(&data->hid_stream, bytes + 1, len - 1,
+                    ticks_to_microsecs(gettime()));
 }
 
 static void hid_connect_intr_cb(const BtConnectResult *result, void *cb_data)
@@ -1240,7 +1528,8 @@ static void hid_connect_intr_cb(const BtConnectResult *result, void *cb_data)
     }
 
     data->conn_status = CONN_STATUS_CONNECTED;
-    /* TODO: get some info */
+    data->hid_intr_handle = result->handle;
+    bt_l2cap_handle_notify(result->handle, hid_intr_notify_cb, data);
 }
 
 static void hid_connect_ctrl_cb(const BtConnectResult *result, void *cb_data)
@@ -1255,6 +1544,7 @@ static void hid_connect_ctrl_cb(const BtConnectResult *result, void *cb_data)
         return;
     }
 
+    data->hid_ctrl_handle = result->handle;
     bt_connect(data->device.bdaddr, true, BT_PSM_HID_INTR,
                hid_connect_intr_cb, data);
 }
@@ -1266,11 +1556,68 @@ static void screen_hid_reset()
     data->error_code = 0;
     data->l2cap_status = 0;
     data->conn_status = CONN_STATUS_CONNECTING;
+    data->has_hid_report = false;
+    data->hid_num_values = 0;
+    data->hid_num_rejected = 0;
+    /* A device seen before can be decoded without identifying it again */
+    if (!data->has_hid_layout) {
+        data->has_hid_layout =
+            hid_layout_cache_get_for_device(&data->hid_layout,
+                                            data->device.bdaddr);
+    }
+    data->hid_output_field = -1;
+    data->hid_output_value = 0;
+    if (data->has_hid_layout) {
+        hid_dispatch_init(&data->hid_dispatch, &data->hid_layout);
+        hid_output_init(&data->hid_output, &data->hid_layout);
+        data->hid_output_field = hid_output_next_field(&data->hid_output, -1);
+    }
+    hid_stream_init(&data->hid_stream);
     set_animating(true);
     bt_connect(data->device.bdaddr, true, BT_PSM_HID_CONTROL,
                hid_connect_ctrl_cb, data);
 }
 
+static void screen_hid_pop()
+{
+    DeviceData *data = &s_device_data;
+
+    /* The interrupt channel goes first */
+    if (data->hid_intr_handle) {
+        bt_l2cap_handle_close(data->hid_intr_handle);
+        data->hid_intr_handle = NULL;
+    }
+    if (data->hid_ctrl_handle) {
+        bt_l2cap_handle_close(data->hid_ctrl_handle);
+        data->hid_ctrl_handle = NULL;
+    }
+}
+
+static void print_hid_report(const DeviceData *data, int max_rows)
+{
+    const HidStreamReport *report = &data->hid_report;
+
+    printf("Report (%d bytes):", report->len);
+    for (int i = 0; i < report->len && i < 24; i++) {
+        printf(" %02x", report->data[i]);
+    }
+    printf("%s\n", report->len > 24 ? "..." : "");
+
+    if (!data->has_hid_layout) {
+        printf("Run \"Quick identify\" first to decode the fields.\n");
+        return;
+    }
+
+    /* Two values per row */
+    int num_values = data->hid_num_values;
+    if (num_values > HID_MAX_VALUES) num_values = HID_MAX_VALUES;
+    for (int i = 0; i < num_values && i / 2 < max_rows; i++) {
+        const HidValue *value = &data->hid_values[i];
+        printf("%04x:%04x = %-8d%s", value->usage >> 16, value->usage & 0xffff,
+               value->value, i % 2 == 1 ? "\n" : "      ");
+    }
+}
+
 static void screen_hid_draw()
 {
     const DeviceData *data = &s_device_data;
@@ -1287,22 +1634,117 @@ static void screen_hid_draw()
 
     if (data->conn_status == CONN_STATUS_CONNECTING) {
         printf("Connecting... %c\n", anim_char);
-    } else {
-        printf("%s      \n", data->conn_status == CONN_STATUS_CONNECTED ?
-               "Connecting" : "Connected");
+    } else if (data->conn_status == CONN_STATUS_DISCONNECTED) {
+        printf("Disconnected     \n");
         printf("Error code = %d, status = %d", data->error_code, data->l2cap_status);
+    } else {
+        const HidStream *stream = &data->hid_stream;
+        const HidStreamStats *stats = &stream->stats;
+        printf("Connected. %lu reports, %lu dropped\n",
+               (unsigned long)stream->num_reports,
+               (unsigned long)stream->num_dropped);
+        printf("%lu reports/s, interval %lu-%lu us, jitter %lu us\n",
+               (unsigned long)stats->reports_per_sec,
+               (unsigned long)stats->min_interval_us,
+               (unsigned long)stats->max_interval_us,
+               (unsigned long)stats->jitter_us);
+        if (data->has_hid_layout) {
+            printf("Input reports up to %d bytes, %lu rejected\n",
+                   hid_layout_max_report_size(&data->hid_layout, HID_REPORT_INPUT),
+                   (unsigned long)data->hid_num_rejected);
+        }
+        if (data->hid_output_field >= 0) {
+            const HidField *field =
+                &data->hid_layout.fields[data->hid_output_field];
+            const HidOutput *output = &data->hid_output;
+            printf("%s %d, usage %04x:%04x = %d, %lu sends/s, %lu errors\n",
+                   field->type == HID_REPORT_FEATURE ? "Feature" : "Output",
+                   field->report_id,
+                   hid_field_usage(&data->hid_layout, field, 0) >> 16,
+                   hid_field_usage(&data->hid_layout, field, 0) & 0xffff,
+                   data->hid_output_value,
+                   (unsigned long)output->sends_per_sec,
+                   (unsigned long)output->num_errors);
+        }
+        printf("\n");
+        if (data->has_hid_report) {
+            print_hid_report(data, s_screen_h - 15);
+        } else {
+            printf("Waiting for reports... %c\n", anim_char);
+        }
     }
 
     printf(CONSOLE_WHITE CONSOLE_RESET "\x1b[%d;0H", s_screen_h - 4);
     printf("_________________________________\n");
     printf(CONSOLE_WHITE "1 - " CONSOLE_RESET "Back  ");
+    if (data->hid_output_field >= 0) {
+        printf(CONSOLE_WHITE "A - " CONSOLE_RESET "Next output  ");
+        printf(CONSOLE_WHITE "+/- " CONSOLE_RESET "Change value");
+    }
+}
+
+/* Sets all the values of the selected output field; a field of single bits
+ * takes the value as a mask, and its bits past the 32nd are cleared */
+static void hid_output_apply(DeviceData *data)
+{
+    const HidField *field = &data->hid_layout.fields[data->hid_output_field];
+    uint32_t mask = (uint32_t)data->hid_output_value;
+    for (uint16_t n = 0; n < field->count; n++) {
+        int32_t value = data->hid_output_value;
+        if (field->bit_size == 1) value = n < 32 ? (mask >> n) & 1 : 0;
+        hid_output_set(&data->hid_output, field, n, value);
+    }
 }
 
 static void screen_hid_process_input(u32 buttons, u32 held)
 {
+    DeviceData *data = &s_device_data;
+
     if (buttons & WPAD_BUTTON_1) {
         pop_screen();
+        return;
     }
+
+    if (data->hid_output_field >= 0) {
+        if (buttons & WPAD_BUTTON_A) {
+            data->hid_output_field =
+                hid_output_next_field(&data->hid_output, data->hid_output_field);
+            data->hid_output_value = 0;
+            queue_refresh();
+        }
+        if (buttons & (WPAD_BUTTON_PLUS | WPAD_BUTTON_MINUS)) {
+            data->hid_output_value += (buttons & WPAD_BUTTON_PLUS) ? 1 : -1;
+            hid_output_apply(data);
+            queue_refresh();
+        }
+        /* Whatever changed in this frame goes out in one write per report */
+        if (data->conn_status == CONN_STATUS_CONNECTED) {
+            hid_output_flush(&data->hid_output, data->hid_ctrl_handle,
+                             data->hid_intr_handle,
+                             ticks_to_microsecs(gettime()));
+        }
+    }
+
+    /* Only the latest report is shown */
+    bool got_report = false;
+    while (hid_stream_pop(&data->hid_stream, &data->hid_report)) {
+        got_report = true;
+    }
+    if (!got_report) return;
+
+    data->has_hid_report = true;
+    const HidReportRoute *route = data->has_hid_layout ?
+        hid_dispatch_route(&data->hid_dispatch, data->hid_report.data,
+                           data->hid_report.len) : NULL;
+    if (route) {
+        uint16_t len = data->hid_report.len;
+        if (len > HID_STREAM_MAX_REPORT_SIZE) len = HID_STREAM_MAX_REPORT_SIZE;
+        data->hid_num_values =
+            hid_dispatch_decode(&data->hid_dispatch, route,
+                                data->hid_report.data, len,
+                                data->hid_values, HID_MAX_VALUES);
+    }
+    queue_refresh();
 }
 
 static void link_key_request_cb(const BtLinkKeyRequestData *event,
@@ -1478,10 +1920,17 @@ static const ScreenMethods s_screens[SCREEN_LAST] = {
         screen_sdp_hid_process_input,
         screen_sdp_hid_pop,
     },
+    [SCREEN_SDP_IDENTIFY] = {
+        screen_sdp_identify_reset,
+        screen_sdp_draw,
+        screen_sdp_process_input,
+        screen_sdp_pop,
+    },
     [SCREEN_HID] = {
         screen_hid_reset,
         screen_hid_draw,
         screen_hid_process_input,
+        screen_hid_pop,
     },
     [SCREEN_PAIR] = {
         screen_pair_reset,
@@ -1515,6 +1964,9 @@ int main(int argc, char **argv) {
     CON_InitEx(rmode, 0, 0, rmode->fbWidth,rmode->xfbHeight);
     CON_GetMetrics(&s_screen_w, &s_screen_h);
 
+    /* SDP responses are cached on the SD card, if there is one */
+    sdp_cache_init();
+
     int frames_since_last_refresh = 0;
     while (!s_quit_requested) {
         WPAD_ScanPads();
@@ -17,9 +17,6 @@
 
 #define ri_ItemSize(sizeMask)      ((uint8_t)(sizeMask) == Size_4B?4:(uint8_t)(sizeMask))
 
-static PrintFunc s_print_func = NULL;
-static void *s_context = NULL;
-
 const char *ri_ColletionType(uint8_t itemData)
 {
     static const char *colType[] = {
@@ -41,14 +38,12 @@ const char *ri_ColletionType(uint8_t itemData)
     return "Unknown";
 }
 
-uint8_t *ri_dataType(uint8_t itemTag, int32_t itemData)
+/* str must hold RI_STR_BUFFER_SIZE bytes */
+char *ri_dataType(uint8_t itemTag, int32_t itemData, char *str)
 {
-#define STR_BUFFER_SIZE     (128U)
-    static char str[STR_BUFFER_SIZE];
-
     int index = 0;
 
-    memset(str, 0, STR_BUFFER_SIZE);
+    memset(str, 0, RI_STR_BUFFER_SIZE);
     /* Only data byte 0 is used now. */
     index += ri_StringGet(str + index, "%s", (itemData & Constant)?"Cnst":"Data");
     index += ri_StringGet(str + index, "%s", (itemData & Variable)?", Var":", Array");
@@ -71,44 +66,30 @@ uint8_t *ri_dataType(uint8_t itemTag, int32_t itemData)
         index += ri_StringGet(str + index, ", ???");
 
     str[index] = 0;
-    return (uint8_t *)str;
+    return str;
 }
 
-void  ri_MainItem(uint8_t itemTag, int32_t itemData, uint8_t *pspace)
+static int32_t ri_MainItem(const RiItem *item, char *str)
 {
-    char str[256] = {0};
-    int32_t index = 0;
+    char dataType[RI_STR_BUFFER_SIZE];
+    int32_t itemData = item->data;
 
-    for (; index < *pspace; index++)
-        str[index] = ' ';
-
-    switch(itemTag)
+    switch(item->tag)
     {
     case Input(0):
-        index += ri_StringGet(str + index, "  Input (%s)", ri_dataType(Input(0), itemData));
-        break;
+        return ri_StringGet(str, "  Input (%s)", ri_dataType(Input(0), itemData, dataType));
     case Output(0):
-        index += ri_StringGet(str + index, "  Output (%s)", ri_dataType(Output(0), itemData));
-        break;
+        return ri_StringGet(str, "  Output (%s)", ri_dataType(Output(0), itemData, dataType));
     case Feature(0):
-        index += ri_StringGet(str + index, "  Feature (%s)", ri_dataType(Feature(0), itemData));
-        break;
+        return ri_StringGet(str, "  Feature (%s)", ri_dataType(Feature(0), itemData, dataType));
     case Collection(0):
-        *pspace += 2;
-        index += ri_StringGet(str + index, "Collection (%s)", ri_ColletionType((uint8_t)itemData));
-        if(itemData & 0xFFFFFF00U)
-            index += ri_StringGet(str + index, " ???");
-        break;
+        return ri_StringGet(str, "Collection (%s)%s", ri_ColletionType((uint8_t)itemData),
+                            (itemData & 0xFFFFFF00U)?" ???":"");
     case End_Colletion(0):
-        *pspace -= 2;
-        index -= 2;
-        index += ri_StringGet(str + index, "End Collection");
-        break;
+        return ri_StringGet(str, "End Collection");
     default:
-        index += ri_StringGet(str + index, "Unknown Item: %02X", itemTag);
-        break;
+        return ri_StringGet(str, "Unknown Item: %02X", item->tag);
     }
-    s_print_func(str, s_context);
 }
 
 const char *ri_UsagePage(int32_t itemData)
@@ -186,9 +167,9 @@ int32_t ri_GetItemData(const uint8_t *itemData, uint8_t size)
     return 0;
 }
 
-char *ri_Exponent(int32_t itemData)
+const char *ri_Exponent(int32_t itemData)
 {
-    static char *str[] = {"5","6","7","-8","-7","-6","-5","-4","-3","-2","-1"};
+    static const char *const str[] = {"5","6","7","-8","-7","-6","-5","-4","-3","-2","-1"};
 
     uint8_t code = (uint8_t)itemData;
 
@@ -200,10 +181,9 @@ char *ri_Exponent(int32_t itemData)
 
 #define NibbleToByte(nibble)    (((int8_t)nibble & 0x08)?((int8_t)nibble | 0xF0):(int8_t)nibble)
 
-char *ri_Unit(uint32_t itemData)
+/* str must hold RI_STR_BUFFER_SIZE bytes */
+const char *ri_Unit(uint32_t itemData, char *str)
 {
-    static char str[128] = {0};
-
     char *strUnit_SI_Linear[] = {"SI Linear","cm","Gram","Seconds","Kelvin","Ampere","Candela"};
     char *strUnit_SI_Rotation[] = {"SI Rotation","rad","Gram","Seconds","Kelvin","Ampere","Candela"};
     char *strUnit_English_Linear[] = {"English Linear","Inch","Slug","Seconds","Fahrenheit","Ampere","Candela"};
@@ -250,161 +230,209 @@ char *ri_Unit(uint32_t itemData)
     return str;
 }
 
-void ri_GlobalItem(uint8_t itemTag, int32_t itemData, uint8_t space, int32_t *pUsagePage)
+static int32_t ri_GlobalItem(const RiItem *item, char *str)
 {
-    char str[256] = {0};
-    int32_t index = 0;
+    char unit[RI_STR_BUFFER_SIZE];
+    int32_t itemData = item->data;
 
-    for (; index < space; index++)
-        str[index] = ' ';
-
-    switch(itemTag)
+    switch(item->tag)
     {
     case Usage_Page(0):
-        *pUsagePage = itemData;
-        index += ri_StringGet(str + index, "Usage Page (%s)", ri_UsagePage(itemData));
-        break;
+        return ri_StringGet(str, "Usage Page (%s)", ri_UsagePage(itemData));
     case Logical_Minimum(0):
-        index += ri_StringGet(str + index, "Logical Min (%d)", itemData);
-        break;
+        return ri_StringGet(str, "Logical Min (%d)", itemData);
     case Logical_Maximum(0):
-        index += ri_StringGet(str + index, "Logical Max (%d)", itemData);
-        break;
+        return ri_StringGet(str, "Logical Max (%d)", itemData);
     case Physical_Minimum(0):
-        index += ri_StringGet(str + index, "Physical Min (%d)", itemData);
-        break;
+        return ri_StringGet(str, "Physical Min (%d)", itemData);
     case Physical_Maximum(0):
-        index += ri_StringGet(str + index, "Physical Max (%d)", itemData);
-        break;
+        return ri_StringGet(str, "Physical Max (%d)", itemData);
     case Unit_Exponent(0):
-        index += ri_StringGet(str + index, "Unit Exponent (%s)", ri_Exponent(itemData));
-        break;
+        return ri_StringGet(str, "Unit Exponent (%s)", ri_Exponent(itemData));
     case Unit(0):
-        index += ri_StringGet(str + index, "Unit (%s)", ri_Unit((uint32_t)itemData));
-        break;
+        return ri_StringGet(str, "Unit (%s)", ri_Unit((uint32_t)itemData, unit));
     case Report_Size(0):
-        index += ri_StringGet(str + index, "Report Size (%d)", itemData);
-        break;
+        return ri_StringGet(str, "Report Size (%d)", itemData);
     case Report_ID(0):
-        index += ri_StringGet(str + index, "Report ID (%d)", itemData);
-        break;
+        return ri_StringGet(str, "Report ID (%d)", itemData);
     case Report_Count(0):
-        index += ri_StringGet(str + index, "Report Count (%d)", itemData);
-        break;
+        return ri_StringGet(str, "Report Count (%d)", itemData);
     case Push(0):
-        index += ri_StringGet(str + index, "Push");
-        break;
+        return ri_StringGet(str, "Push");
     case Pop(0):
-        index += ri_StringGet(str + index, "Pop");
-        break;
+        return ri_StringGet(str, item->bad?"Pop ???":"Pop");
     default:
-        index += ri_StringGet(str + index, "Unknown Item: %02X", itemTag);
-        break;
+        return ri_StringGet(str, "Unknown Item: %02X", item->tag);
     }
-
-    s_print_func(str, s_context);
 }
 
 #define ri_DelimiterItem(itemData)  (((int32_t)itemData)? \
                                      (((int32_t)itemData == 1)?"Open Set":"Unknown Setting"): \
                                      "Close Set")
 
-void ri_LocalItem(uint8_t itemTag, int32_t itemData, uint8_t space, int32_t usagePage)
+static int32_t ri_LocalItem(const RiItem *item, char *str)
 {
-    char str[256] = {0};
-    int32_t index = 0;
-
-    for (; index < space; index++)
-        str[index] = ' ';
+    char usage[RI_STR_BUFFER_SIZE];
+    int32_t itemData = item->data;
 
-    switch(itemTag)
+    switch(item->tag)
     {
     case Usage(0):
-        /* TODO: 根据Usage Page查表 */
-        index += ri_StringGet(str + index, "Usage (%s)", ri_Usage(usagePage, itemData));
-        break;
+        return ri_StringGet(str, "Usage (%s)", ri_Usage(item->usage_page, itemData, usage, sizeof(usage)));
     case Usage_Minimum(0):
-        index += ri_StringGet(str + index, "Usage Min (%d)", itemData);
-        break;
+        return ri_StringGet(str, "Usage Min (%d)", itemData);
     case Usage_Maximum(0):
-        index += ri_StringGet(str + index, "Usage Max (%d)", itemData);
-        break;
+        return ri_StringGet(str, "Usage Max (%d)", itemData);
     case Designator_Index(0):
-        index += ri_StringGet(str + index, "Designator Index (%d)", itemData);
-        break;
+        return ri_StringGet(str, "Designator Index (%d)", itemData);
     case Designator_Minimum(0):
-        index += ri_StringGet(str + index, "Designator Min (%d)", itemData);
-        break;
+        return ri_StringGet(str, "Designator Min (%d)", itemData);
     case Designator_Maximum(0):
-        index += ri_StringGet(str + index, "Designator Max (%d)", itemData);
-        break;
+        return ri_StringGet(str, "Designator Max (%d)", itemData);
     case String_Index(0):
-        index += ri_StringGet(str + index, "String Index (%d)", itemData);
-        break;
+        return ri_StringGet(str, "String Index (%d)", itemData);
     case String_Minimum(0):
-        index += ri_StringGet(str + index, "String Min (%d)", itemData);
-        break;
+        return ri_StringGet(str, "String Min (%d)", itemData);
     case String_Maximum(0):
-        index += ri_StringGet(str + index, "String Max (%d)", itemData);
-        break;
+        return ri_StringGet(str, "String Max (%d)", itemData);
     case Delimiter(0):
         /* defines the deginning or end of a set of local items. 
         ** 1 = open set, 0 = close set. 
         */
-        index += ri_StringGet(str + index, "Delimiter (%s)", ri_DelimiterItem(itemData));
+        return ri_StringGet(str, "Delimiter (%s)", ri_DelimiterItem(itemData));
     default:
-        index += ri_StringGet(str + index, "Unknown Item: %02X", itemTag);
+        return ri_StringGet(str, "Unknown Item: %02X", item->tag);
+    }
+}
+
+char *ri_FormatItem(const RiItem *item, char *str)
+{
+    /* Two columns per level of collection, up to half the line */
+    int32_t index = item->depth * 2;
+
+    if(index > RI_ITEM_STR_SIZE / 2)
+        index = RI_ITEM_STR_SIZE / 2;
+    memset(str, ' ', index);
+    str[index] = 0;
+
+    switch(item->type)
+    {
+    case MAIN_ITEM:
+        ri_MainItem(item, str + index);
+        break;
+    case GLOBAL_ITEM:
+        ri_GlobalItem(item, str + index);
+        break;
+    case LOCAL_ITEM:
+        ri_LocalItem(item, str + index);
+        break;
+    default:
+        ri_StringGet(str + index, "Unknown Type: %02X, index: %d", item->tag, item->offset);
         break;
     }
+    return str;
+}
 
-    s_print_func(str, s_context);
+/* Updates the state of the parser with the item, before it is handed out */
+static void ri_ParserUpdate(RiParser *parser, RiItem *item)
+{
+    switch(item->tag)
+    {
+    case Collection(0):
+        item->depth = parser->depth;
+        if(parser->depth < 0xFFU)
+            parser->depth++;
+        break;
+    case End_Colletion(0):
+        if(parser->depth > 0)
+            parser->depth--;
+        item->depth = parser->depth;
+        break;
+    case Usage_Page(0):
+        parser->usage_page = item->data;
+        break;
+    case Push(0):
+        if(parser->push_depth < RI_PUSH_DEPTH)
+            parser->usage_page_stack[parser->push_depth] = parser->usage_page;
+        parser->push_depth++;
+        break;
+    case Pop(0):
+        if(parser->push_depth == 0)
+        {
+            item->bad = 1;
+            break;
+        }
+        parser->push_depth--;
+        if(parser->push_depth < RI_PUSH_DEPTH)
+            parser->usage_page = parser->usage_page_stack[parser->push_depth];
+        break;
+    }
+    item->usage_page = parser->usage_page;
 }
 
-int ri_Parse(const uint8_t *buf, uint16_t len,
-             PrintFunc print_func, void *context)
+void ri_ParserInit(RiParser *parser, ItemFunc item_func, void *context)
+{
+    memset(parser, 0, sizeof(*parser));
+    parser->item_func = item_func;
+    parser->context = context;
+    parser->usage_page = -1;
+}
+
+int ri_ParserRun(RiParser *parser, const uint8_t *buf, uint16_t len)
 {
-    uint8_t space = 0;
     uint16_t index = 0;
 
-    s_print_func = print_func;
-    s_context = context;
     LOGD("Report Item Parse:\r\n");
     while(index < len)
     {
-        static int32_t sUsagePage = -1;
-
-        uint8_t itemTag = buf[index] & TAG_MASK;
-        uint8_t itemSize = ri_ItemSize(buf[index] & SIZE_MASK);
-        int32_t itemData = 0;
+        RiItem item = {0};
+        item.tag = buf[index] & TAG_MASK;
+        item.type = buf[index] & TYPE_MASK;
+        item.size = ri_ItemSize(buf[index] & SIZE_MASK);
+        item.offset = index;
 
-        if(index + itemSize >= len)
+        if(index + item.size >= len)
         {
             LOGE("out of buffer.\r\n");
             break;
         }
-        
-        itemData = ri_GetItemData(&buf[index + 1], itemSize);
-        switch(itemTag & TYPE_MASK)
-        {
-        case MAIN_ITEM:
-            ri_MainItem(itemTag, itemData, &space);
-            break;
-        case GLOBAL_ITEM:
-            ri_GlobalItem(itemTag, itemData, space, &sUsagePage);
-            break;
-        case LOCAL_ITEM:
-            ri_LocalItem(itemTag, itemData, space, sUsagePage);
-            break;
-        default:
-            {
-                char buffer[128];
-                snprintf(buffer, sizeof(buffer), "Unknown Type: %02X, index: %d", itemTag, index);
-                s_print_func(buffer, s_context);
-            }
-            break;
-        }
-        index += (itemSize + 1);
+
+        item.data = ri_GetItemData(&buf[index + 1], item.size);
+        item.depth = parser->depth;
+        ri_ParserUpdate(parser, &item);
+        parser->item_func(&item, parser->context);
+        index += (item.size + 1);
     }
 
     return (index < len);
 }
+
+int ri_ParseItems(const uint8_t *buf, uint16_t len,
+                  ItemFunc item_func, void *context)
+{
+    RiParser parser;
+
+    ri_ParserInit(&parser, item_func, context);
+    return ri_ParserRun(&parser, buf, len);
+}
+
+typedef struct {
+    PrintFunc print_func;
+    void *context;
+} RiPrinter;
+
+static void ri_PrintItem(const RiItem *item, void *context)
+{
+    RiPrinter *printer = context;
+    char str[RI_ITEM_STR_SIZE];
+
+    printer->print_func(ri_FormatItem(item, str), printer->context);
+}
+
+int ri_Parse(const uint8_t *buf, uint16_t len,
+             PrintFunc print_func, void *context)
+{
+    RiPrinter printer = { print_func, context };
+
+    return ri_ParseItems(buf, len, ri_PrintItem, &printer);
+}
@@ -177,7 +177,54 @@
 #define LOGE(x)        LOGD(x)
 #endif
 
+#define RI_STR_BUFFER_SIZE               (128U)
+#define RI_ITEM_STR_SIZE                 (256U)
+#define RI_PUSH_DEPTH                    (8U)
+
+/* Type of the items which are neither main, global nor local */
+#define RESERVED_ITEM                       (0x03U<<TYPE_OFFSET)
+
+/* One item of the descriptor, as found by the parser: turning it into text
+** is left to ri_FormatItem(), so that only the items which are shown need
+** to be formatted.
+*/
+typedef struct {
+    uint8_t tag;            /* tag and type, without the size bits */
+    uint8_t type;           /* MAIN_ITEM, GLOBAL_ITEM, LOCAL_ITEM... */
+    uint8_t size;           /* of the data, in bytes */
+    uint8_t depth;          /* collection nesting, the same for a
+                            ** Collection and its End Collection */
+    uint8_t bad;            /* does not fit the state: Pop without Push */
+    uint16_t offset;        /* of the item in the descriptor */
+    int32_t data;
+    int32_t usage_page;     /* current after the item, -1 if none yet */
+} RiItem;
+
+typedef void (*ItemFunc)(const RiItem *item, void *context);
 typedef void (*PrintFunc)(const char *output, void *context);
+
+/* All the state of a parse, so that several descriptors can be parsed at
+** the same time and each parse starts from a clean state.
+*/
+typedef struct {
+    ItemFunc item_func;
+    void *context;
+    uint8_t depth;          /* of the collection */
+    int32_t usage_page;     /* -1 until a Usage Page item is found */
+    /* Usage pages saved by Push items */
+    int32_t usage_page_stack[RI_PUSH_DEPTH];
+    uint8_t push_depth;
+} RiParser;
+
+void ri_ParserInit(RiParser *parser, ItemFunc item_func, void *context);
+/* Returns non zero if the descriptor ends with a truncated item */
+int ri_ParserRun(RiParser *parser, const uint8_t *buf, uint16_t len);
+/* Same as ri_ParserInit() followed by ri_ParserRun() */
+int ri_ParseItems(const uint8_t *buf, uint16_t len, ItemFunc item_func, void *context);
+
+/* Writes the item as one indented line; str must hold RI_ITEM_STR_SIZE bytes */
+char *ri_FormatItem(const RiItem *item, char *str);
+/* Parses the descriptor and formats every item */
 int ri_Parse(const uint8_t *buf, uint16_t len, PrintFunc print_func, void *context);
 
 #endif //_REPORT_ITEM_H
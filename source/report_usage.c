@@ -1,1959 +1,902 @@
 #include "report_usage.h"
 
+#include <stddef.h>
 #include <stdio.h>
 
-const char *ri_GenericDesktop(int32_t usage)
-{
-    switch (usage)
-    {
-    case GD_Pointer:
-        return "Pointer";
-    case GD_Mouse:
-        return "Mouse";
-    case GD_Joystick:
-        return "Joystick";
-    case GD_Game_Pad:
-        return "Game Pad";
-    case GD_Keyboard:
-        return "Keyboard";
-    case GD_Keypad:
-        return "Keypad";
-    case GD_Multiaxis_Controller:
-        return "Multi-axis Controller";
-    case GD_Tablet_PC_Sys_Controls:
-        return "Tablet PC System Controls";
-    case GD_X:
-        return "X";
-    case GD_Y:
-        return "Y";
-    case GD_Z:
-        return "Z";
-    case GD_Rx:
-        return "Rx";
-    case GD_Ry:
-        return "Ry";
-    case GD_Rz:
-        return "Rz";
-    case GD_Slider:
-        return "Slider";
-    case GD_Dial:
-        return "Dial";
-    case GD_Wheel:
-        return "Wheel";
-    case GD_Hat_Switch:
-        return "Switch";
-    case GD_Counted_Buffer:
-        return "Counted Buffer";
-    case GD_Byte_Count:
-        return "Byte Count";
-    case GD_Motion_Wakeup:
-        return "Motion Wakeup";
-    case GD_Start:
-        return "Start";
-    case GD_Select:
-        return "Select";
-    case GD_Vx:
-        return "Vx";
-    case GD_Vy:
-        return "Vy";
-    case GD_Vz:
-        return "Vz";
-    case GD_Vbrx:
-        return "Vbrx";
-    case GD_Vbry:
-        return "Vbry";
-    case GD_Vbrz:
-        return "Vbrz";
-    case GD_Vno:
-        return "Vno";
-    case GD_Feature_Notification:
-        return "Feature Notification";
-    case GD_Resolution_Multiplier:
-        return "Resolution Multiplier";
-    case GD_Sys_Control:
-        return "System Control";
-    case GD_Sys_Power_Down:
-        return "System Power Down";
-    case GD_Sys_Sleep:
-        return "System Sleep";
-    case GD_Sys_Wake_Up:
-        return "System Wake Up";
-    case GD_Sys_Context_Menu:
-        return "System Context Menu";
-    case GD_Sys_Main_Menu:
-        return "System Main Menu";
-    case GD_Sys_App_Menu:
-        return "System App Menu";
-    case GD_Sys_Menu_Help:
-        return "System Menu Help";
-    case GD_Sys_Menu_Exit:
-        return "System Menu Exit";
-    case GD_Sys_Menu_Select:
-        return "System Menu Select";
-    case GD_Sys_Menu_Right:
-        return "System Menu Right";
-    case GD_Sys_Menu_Left:
-        return "System Menu Left";
-    case GD_Sys_Menu_Up:
-        return "System Menu Up";
-    case GD_Sys_Menu_Down:
-        return "System Menu Down";
-    case GD_Sys_Cold_Restart:
-        return "System Cold Restart";
-    case GD_Sys_Warm_Restart:
-        return "System Warm Restart";
-    case GD_D_pad_Up:
-        return "D-pad Up";
-    case GD_D_pad_Down:
-        return "D-pad Down";
-    case GD_D_pad_Right:
-        return "D-pad Right";
-    case GD_D_pad_Left:
-        return "D-pad Left";
-    case GD_Sys_Dock:
-        return "System Dock";
-    case GD_Sys_Undock:
-        return "SYstem Undock";
-    case GD_Sys_Setup:
-        return "System Setup";
-    case GD_Sys_Break:
-        return "System Break";
-    case GD_Sys_Debugger_Break:
-        return "System Debugger Break";
-    case GD_Application_Break:
-        return "Application Break";
-    case GD_Application_Debugger_Break:
-        return "Application Debugger Break";
-    case GD_Sys_Speaker_Mute:
-        return "System Speaker Mute";
-    case GD_Sys_Hibernate:
-        return "System Hibernate";
-    case GD_Sys_Display_Invert:
-        return "System Display Invert";
-    case GD_Sys_Display_Internal:
-        return "System Display Internal";
-    case GD_Sys_Display_External:
-        return "System Display External";
-    case GD_Sys_Display_Both:
-        return "System Display Both";
-    case GD_Sys_Display_Dual:
-        return "System Display Dual";
-    case GD_Sys_Display_Toggle:
-        return "System Display Toggle";
-    case GD_Sys_Display_Swap:
-        return "System Display Swap";
-    case GD_Sys_Display_LCD_Autoscale:
-        return "System Display LCD Autoscale";
-    default:
-        return "Unknown";
-    }
-}
-
-const char *ri_SimulationControls(int32_t usage)
-{
-    switch (usage)
-    {
-    case SC_SimuDev_Flight:
-        return "Flight Simulation Device";
-    case SC_SimuDev_Automobile:
-        return "Automobile Simulation Device";
-    case SC_SimuDev_Tank:
-        return "Tank Simulation Device";
-    case SC_SimuDev_Spaceship:
-        return "Spaceship Simulation Device";
-    case SC_SimuDev_Submarine:
-        return "Submarine Simulation Device";
-    case SC_SimuDev_Sailing:
-        return "Sailing Simulation Device";
-    case SC_SimuDev_Motorcycle:
-        return "Motorcycle Simulation Device";
-    case SC_SimuDev_Sports:
-        return "Sports Simulation Device";
-    case SC_SimuDev_Airplane:
-        return "Airplane Simulation Device";
-    case SC_SimuDev_Helicopter:
-        return "Helicopter Simulation Device";
-    case SC_SimuDev_MagicCarpet:
-        return "MagicCarpet Simulation Device";
-    case SC_SimuDev_Bicycle:
-        return "Bicycle Simulation Device";
-    case SC_Flight_Control_Stick:
-        return "Flight Control Stick";
-    case SC_Flilght_Stick:
-        return "Flilght Stick";
-    case SC_Cyclic_Control:
-        return "Cyclic Control";
-    case SC_Cyclic_Trim:
-        return "Cyclic Trim";
-    case SC_Flight_Yoke:
-        return "Flight Yoke";
-    case SC_Track_Control:
-        return "Track Control";
-    case SC_Aileron:
-        return "Aileron";
-    case SC_Aileron_Trim:
-        return "Aileron Trim";
-    case SC_Anti_Torque_Control:
-        return "Anti Torque Control";
-    case SC_Autopilot_Enable:
-        return "Autopilot Enable";
-    case SC_Chaff_Release:
-        return "Chaff Release";
-    case SC_Collective_Control:
-        return "Collective Control";
-    case SC_Dive_Brake:
-        return "Dive Brake";
-    case SC_Electronic_Countermeasures:
-        return "Electronic Countermeasures";
-    case SC_Elevator:
-        return "Elevator";
-    case SC_Elevator_Trim:
-        return "Elevator Trim";
-    case SC_Rudder:
-        return "Rudder";
-    case SC_Throttle:
-        return "Throttle";
-    case SC_Flight_Communications:
-        return "Flight Communications";
-    case SC_Flare_Release:
-        return "Flare Release";
-    case SC_Landing_Gear:
-        return "Landing Gear";
-    case SC_Toe_Brake:
-        return "Toe Brake";
-    case SC_Trigger:
-        return "Trigger";
-    case SC_Weapons_Arm:
-        return "Weapons Arm";
-    case SC_Weapons_Select:
-        return "Weapons Select";
-    case SC_Wing_Flaps:
-        return "Wing Flaps";
-    case SC_Accelerator:
-        return "Accelerator";
-    case SC_Brake:
-        return "Brake";
-    case SC_Clutch:
-        return "Clutch";
-    case SC_Shifter:
-        return "Shifter";
-    case SC_Steering:
-        return "Steering";
-    case SC_Turret_Direction:
-        return "Turret Direction";
-    case SC_Barrel_Elevation:
-        return "Barrel Elevation";
-    case SC_Dive_Plane:
-        return "Dive Plane";
-    case SC_Ballast:
-        return "Ballast";
-    case SC_Bicycle_Crank:
-        return "Bicycle Crank";
-    case SC_Handle_Bars:
-        return "Handle Bars";
-    case SC_Front_Brake:
-        return "Front Brake";
-    case SC_Rear_Brake:
-        return "Rear Brake";
-    default:
-        return "Unkonwn";
-    }
-}
-
-const char *ri_VRControls(int32_t usage)
-{
-    switch(usage)
-    {
-    case VR_Belt:
-        return "Belt";
-    case VR_Body_Suit:
-        return "Body Suit";
-    case VR_Flexor:
-        return "Flexor";
-    case VR_Glove:
-        return "Glove";
-    case VR_Head_Tracker:
-        return "Head Tracker";
-    case VR_Head_Mounted_Display:
-        return "Head Mounted Display";
-    case VR_Hand_Tracker:
-        return "Hand Tracker";
-    case VR_Oculometer:
-        return "Oculometer";
-    case VR_Vest:
-        return "Vest";
-    case VR_Animatronic_Device:
-        return "Animatronic Device";
-    case VR_Stereo_Enable:
-        return "Stereo Enable";
-    case VR_Display_Enable:
-        return "Display Enable";
-    default:
-        return "Unknown";
-    }
-}
-
-const char *ri_SportControls(int32_t usage)
-{
-    switch(usage)
-    {
-    case SpC_Baseball_Bat:
-        return "Baseball Bat";
-    case SpC_Golf_Club:
-        return "Golf Club";
-    case SpC_Rowing_Machine:
-        return "Rowing Machine";
-    case SpC_Treadmill:
-        return "Treadmill";
-    case SpC_Oar:
-        return "Oar";
-    case SpC_Slope:
-        return "Slope";
-    case SpC_Rate:
-        return "Rate";
-    case SpC_Stick_Speed:
-        return "Stick Speed";
-    case SpC_Stick_Face_Angle:
-        return "Stick Face Angle";
-    case SpC_Stick_HeelorToe:
-        return "Stick HeelorToe";
-    case SpC_Stick_Follow_Through:
-        return "Stick Follow Through";
-    case SpC_Stick_Tempo:
-        return "Stick Tempo";
-    case SpC_Stick_Type:
-        return "Stick Type";
-    case SpC_Stick_Height:
-        return "Stick Height";
-    case SpC_Putter:
-        return "Putter";
-    case SpC_Iron_1:
-    case SpC_Iron_2:
-    case SpC_Iron_3:
-    case SpC_Iron_4:
-    case SpC_Iron_5:
-    case SpC_Iron_6:
-    case SpC_Iron_7:
-    case SpC_Iron_8:
-    case SpC_Iron_9:
-    case SpC_Iron_10:
-    case SpC_Iron_11:
-        return "Iron";
-    case SpC_Sand_Wedge:
-        return "Sand Wedge";
-    case SpC_Loft_Wedge:
-        return "Loft Wedge";
-    case SpC_Power_Wedge:
-        return "Power Wedge";
-    case SpC_Wood_1:
-    case SpC_Wood_3:
-    case SpC_Wood_5:
-    case SpC_Wood_7:
-    case SpC_Wood_9:
-        return "Wood";
-    default:
-        return "Unknown";
-    }
-}
-
-const char *ri_GameControls(int32_t usage)
-{
-    switch(usage)
-    {
-    case GC_3D_Game_Controller:
-        return "3D Game Controller ";
-    case GC_Pinball_Device:
-        return "Pinball Device ";
-    case GC_Gun_Device:
-        return "Gun Device";
-    case GC_Point_of_View:
-        return "Point of View";
-    case GC_Turn_Right_Left:
-        return "Turn Right/Left";
-    case GC_Pitch_Forward_Backward:
-        return "Pitch Forward/Backward";
-    case GC_Roll_Right_Left:
-        return "Roll Right/Left";
-    case GC_Move_Right_Left:
-        return "Move Right/Left";
-    case GC_Move_Forward_Backward:
-        return "Move Forward/Backward";
-    case GC_Move_Up_Down:
-        return "Move Up/Down";
-    case GC_Lean_Right_Left:
-        return "Lean Right/Left";
-    case GC_Lean_Forward_Backward:
-        return "Lean Forward/Backward";
-    case GC_Height_of_POV:
-        return "Height of POV";
-    case GC_Flipper:
-        return "Flipper";
-    case GC_Secondary_Flipper:
-        return "Secondary Flipper";
-    case GC_Bump:
-        return "Bump";
-    case GC_New_Game:
-        return "New Game";
-    case GC_Shoot_Ball:
-        return "Shoot Ball";
-    case GC_Player:
-        return "Player";
-    case GC_Gun_Bolt:
-        return "Gun Bolt";
-    case GC_Gun_Clip:
-        return "Gun Clip";
-    case GC_Gun_Selector:
-        return "Gun Selector";
-    case GC_Gun_Single_Shot:
-        return "Gun Single Shot";
-    case GC_Gun_Burst:
-        return "Gun Burst";
-    case GC_Gun_Automatic:
-        return "Gun Automatic";
-    case GC_Gun_Safety:
-        return "Gun Safety";
-    case GC_Gamepad_Fire_Jump:
-        return "Gamepad Fire/Jump";
-    case GC_Gamepad_Trigger:
-        return "Gamepad Trigger";
-    default:
-        return "Unknown";
-    }
-}
-
-const char *ri_GenericDeviceControls(int32_t usage)
-{
-    switch(usage)
-    {
-    case GDC_Battery_Strength:
-	    return "Battery Strength";
-    case GDC_Wireless_Channel:
-        return "Wireless Channel";
-    case GDC_Wireless_ID:
-        return "Wireless ID";
-    case GDC_Discover_Wireless_Ctrl:
-        return "Discover Wireless Ctrl";
-    case GDC_SC_Character_Entered:
-        return "Security Code Character Entered";
-    case GDC_SC_Character_Cleared:
-        return "Security Code Character Cleared";
-    case GDC_SC_Cleared:
-        return "Security Code Cleared";
-    default:
-        return "Unknown";
-    }
-}
-
-const char *ri_KeyboardOrKeypad(int32_t usage)
-{
-    switch(usage)
-    {
-    //TODO:
-    default:
-        return "Unknown";
-    }
-}
-
-const char *ri_LEDs(int32_t usage)
-{
-    switch(usage)
-    {
-    case LED_Num_Lock:
-        return "Num Lock";
-    case LED_Caps_Lock:
-        return "Caps Lock";
-    case LED_Scroll_Lock:
-        return "Scroll Lock";
-    case LED_Compose:
-        return "Compose";
-    case LED_Kana:
-        return "Kana";
-    case LED_Power:
-        return "Power";
-    case LED_Shift:
-        return "Shift";
-    case LED_Donot_Disturb:
-        return "Donot Disturb";
-    case LED_Mute:
-        return "Mute";
-    case LED_Tone_Enable:
-        return "Tone Enable";
-    case LED_High_Cut_Filter:
-        return "High Cut Filter";
-    case LED_Low_Cut_Filter:
-        return "Low Cut Filter";
-    case LED_Equalizer_Enable:
-        return "Equalizer Enable";
-    case LED_Sound_Field_On:
-        return "Sound Field On";
-    case LED_Surround_On:
-        return "Surround On";
-    case LED_Repeat:
-        return "Repeat";
-    case LED_Stereo:
-        return "Stereo";
-    case LED_Sampling_Rate_Detect:
-        return "Sampling Rate Detect";
-    case LED_Spinning:
-        return "Spinning";
-    case LED_CAV:
-        return "CAV";
-    case LED_CLV:
-        return "CLV";
-    case LED_Recording_Format_Detect:
-        return "Recording Format Detect";
-    case LED_Off_Hook:
-        return "Off-Hook";
-    case LED_Ring:
-        return "Ring";
-    case LED_Message_Waiting:
-        return "Message Waiting";
-    case LED_Data_Mode:
-        return "Data Mode";
-    case LED_Battery_Operation:
-        return "Battery Operation";
-    case LED_Battery_OK:
-        return "Battery OK";
-    case LED_Battery_Low:
-        return "Battery LOW";
-    case LED_Speaker:
-        return "Speaker";
-    case LED_Head_Set:
-        return "Head Set";
-    case LED_Hold:
-        return "Hold";
-    case LED_Microphone:
-        return "Microphone";
-    case LED_Coverage:
-        return "Coverage";
-    case LED_Night_Mode:
-        return "Night Mode";
-    case LED_Send_Calls:
-        return "Send Calls";
-    case LED_Call_Pickup:
-        return "Call Pickup";
-    case LED_Conference:
-        return "Conference";
-    case LED_Standby:
-        return "Standby";
-    case LED_Camera_On:
-        return "Camera On";
-    case LED_Camera_Off:
-        return "Camera Off";
-    case LED_On_Line:
-        return "On Line";
-    case LED_Off_Line:
-        return "Off Line";
-    case LED_Busy:
-        return "Busy";
-    case LED_Ready:
-        return "Ready";
-    case LED_Paper_Out:
-        return "Paper Out";
-    case LED_Paper_Jam:
-        return "Paper Jam";
-    case LED_Remote:
-        return "Remote";
-    case LED_Forward:
-        return "Forward";
-    case LED_Reverse:
-        return "Reverse";
-    case LED_Stop:
-        return "Stop";
-    case LED_Rewind:
-        return "Rewind";
-    case LED_Fast_Forward:
-        return "Fast Forward";
-    case LED_Play:
-        return "Play";
-    case LED_Pause:
-        return "Pause";
-    case LED_Record:
-        return "Record";
-    case LED_Error:
-        return "Error";
-    case LED_Selected_Indicator:
-        return "Selected Indicator";
-    case LED_In_Use_Indicator:
-        return "In Use Indicator";
-    case LED_Multi_Mode_Indicator:
-        return "Multi Mode Indicator";
-    case LED_Indicator_On:
-        return "Indicator On";
-    case LED_Indicator_Flash:
-        return "Indicator Flash";
-    case LED_Indicator_Slow_Blink:
-        return "Indicator Slow Blink";
-    case LED_Indicator_Fast_Blink:
-        return "Indicator Fast Blink";
-    case LED_Indicator_Off:
-        return "Indicator Off";
-    case LED_Flash_On_Time:
-        return "Flash On Time";
-    case LED_Slow_Blink_On_Time:
-        return "Slow Blink On Time";
-    case LED_Slow_Blink_Off_Time:
-        return "Slow Blink Off Time";
-    case LED_Fast_Blink_On_Time:
-        return "Fast Blink On Time";
-    case LED_Fast_Blink_Off_Time:
-        return "Fast Blink Off Time";
-    case LED_Usage_Indicator_Color:
-        return "Usage Indicator Color";
-    case LED_Indicator_Red:
-        return "Indicator Red";
-    case LED_Indicator_Green:
-        return "Indicator Green";
-    case LED_Indicator_Amber:
-        return "Indicator Amber";
-    case LED_Generic_Indicator:
-        return "Generic Indicator";
-    case LED_Sys_Suspend:
-        return "System Suspend";
-    case LED_External_Power_Connected:
-        return "External Power Connected";
-    default:
-        return "Unknown";
-    }
-}
-
-const char *ri_Button(int32_t usage)
-{
-    static char str[16];
-
-    sprintf(str,"Button %d", usage);
-
-    return str;
-}
-
-const char *ri_Ordinal(int32_t usage)
-{
-    static char str[16];
-
-    sprintf(str,"Instance %d", usage);
-
-    return str;
-}
-
-const char *ri_Telephony(int32_t usage)
-{
-    switch(usage)
-    {
-	case TD_Phone:	
-    	return "Phone";
-	case TD_Answering_Machine:	
-		return "Answering Machine";
-	case TD_Message_Controls:	
-		return "Message Controls";
-	case TD_Handset:	
-		return "Handset";
-	case TD_Headset:	
-		return "Headset";
-	case TD_Telephony_Key_Pad:	
-		return "Telephony Key Pad";
-	case TD_Programmable_Button:	
-		return "Programmable Button";
-	case TD_Hook_Switch:	
-		return "Hook Switch";
-	case TD_Flash:	
-		return "Flash";
-	case TD_Feature:	
-		return "Feature";
-	case TD_Hold:	
-		return "Hold";
-	case TD_Redial:	
-		return "Redial";
-	case TD_Transfer:	
-		return "Transfer";
-	case TD_Drop:	
-		return "Drop";
-	case TD_Park:	
-		return "Park";
-	case TD_Forward_Calls:	
-		return "Forward Calls";
-	case TD_Alternate_Function:	
-		return "Alternate Function";
-	case TD_Line:	
-		return "Line";
-	case TD_Speaker_Phone:	
-		return "Speaker Phone";
-	case TD_Conference:	
-		return "Conference";
-	case TD_Ring_Enable:	
-		return "Ring Enable";
-	case TD_Ring_Select:	
-		return "Ring Select";
-	case TD_Phone_Mute:	
-		return "Phone Mute";
-	case TD_Caller_ID:	
-		return "Caller ID";
-	case TD_Send:	
-		return "Send";
-	case TD_Speed_Dial:	
-		return "Speed Dial";
-	case TD_Store_Number:	
-		return "Store Number";
-	case TD_Recall_Number:	
-		return "Recall Number";
-	case TD_Phone_Directory:	
-		return "Phone Directory";
-	case TD_Voice_Mail:	
-		return "Voice Mail";
-	case TD_Screen_Calls:	
-		return "Screen Calls";
-	case TD_Do_Not_Disturb:	
-		return "Do Not Disturb";
-	case TD_Message:	
-		return "Message";
-	case TD_Answer_On_Off:	
-		return "Answer On/Off";
-	case TD_Inside_Dial_Tone:	
-		return "Inside Dial Tone";
-	case TD_Outside_Dial_Tone:	
-		return "Outside Dial Tone";
-	case TD_Inside_Ring_Tone:	
-		return "Inside Ring Tone";
-	case TD_Outside_Ring_Tone:	
-		return "Outside Ring Tone";
-	case TD_Priority_Ring_Tone:	
-		return "Priority Ring Tone";
-	case TD_Inside_Ringback:	
-		return "Inside Ringback";
-	case TD_Priority_Ringback:	
-		return "Priority Ringback";
-	case TD_Line_Busy_Tone:	
-		return "Line Busy Tone";
-	case TD_Reorder_Tone:	
-		return "Reorder Tone";
-	case TD_Call_Waiting_Tone:	
-		return "Call Waiting Tone";
-	case TD_Confirmation_Tone_1:	
-		return "Confirmation Tone 1";
-	case TD_Confirmation_Tone_2:	
-		return "Confirmation Tone 2";
-	case TD_Tones_Off:	
-		return "Tones Off";
-	case TD_Outside_Ringback:	
-		return "Outside Ringback";
-	case TD_Ringer:
-		return "Ringer";
-    default:
-        return "Unknown";
-    }
-}
-
-const char *ri_Consumer(int32_t usage)
-{
-    switch(usage)
-    {
-    case UC_Consumer_Ctrl:
-        return "Consumer Control";
-    case UC_Numeric_Keypad:
-        return "Numeric Key Pad";
-    case UC_Prog_Btns:
-        return "Programmable Buttons";
-    case UC_Mic:
-        return "Microphone";
-    case UC_Headphone:
-        return "Headphone";
-    case UC_Graphic_Equalizer:
-        return "Graphic Equalizer";
-    case UC_Add_10:
-        return "+10";
-    case UC_Add_100:
-        return "+100";
-    case UC_AM_PM:
-        return "AM/PM";
-    case UC_Power:
-        return "Power";
-    case UC_Reset:
-        return "Reset";
-    case UC_Sleep:
-        return "Sleep";
-    case UC_Sleep_After:
-        return "Sleep After";
-    case UC_Sleep_Mode:
-        return "Sleep Mode";
-    case UC_ILL:
-        return "Illumination";
-    case UC_Function_Buttons:
-        return "Function Buttons";
-    case UC_Menu:
-        return "Menu";
-    case UC_Menu_Pick:
-        return "Menu Pick";
-    case UC_Menu_Up:
-        return "Menu Up";
-    case UC_Menu_Down:
-        return "Menu Down";
-    case UC_Menu_Left:
-        return "Menu Left";
-    case UC_Menu_Right:
-        return "Menu Right";
-    case UC_Menu_Escape:
-        return "Menu Escape";
-    case UC_Menu_Value_Incr:
-        return "Menu Value Increase";
-    case UC_Menu_Value_Decr:
-        return "Menu Value Decrease";
-    case UC_Data_On_Screen:
-        return "Data On Screen";
-    case UC_Closed_Caption:
-        return "Closed Caption";
-    case UC_Closed_Caption_Sel:
-        return "Closed Caption Select";
-    case UC_VCR_TV:
-        return "VCR/TV";
-    case UC_Broadcast_Mode:
-        return "Broadcast Mode";
-    case UC_Snapshot:
-        return "Snapshot";
-    case UC_Still:
-        return "Still";
-    case UC_Selion:
-        return "Selection";
-    case UC_Assign_Selion:
-        return "Assign Selection";
-    case UC_Mode_Step:
-        return "Mode Step";
-    case UC_Recall_Last:
-        return "Recall Last";
-    case UC_Enter_Channel:
-        return "Enter Channel";
-    case UC_Order_Movie:
-        return "Order Movie";
-    case UC_Channel:
-        return "Channel";
-    case UC_Media_Selion:
-        return "Media Selection";
-    case UC_Media_Sel_Computer:
-        return "Media Select Computer";
-    case UC_Media_Sel_TV:
-        return "Media Select TV";
-    case UC_Media_Sel_WWW:
-        return "Media Select WWW";
-    case UC_Media_Sel_DVD:
-        return "Media Select DVD";
-    case UC_Media_Sel_Telephone:
-        return "Media Select Telephone";
-    case UC_Media_Sel_Program_Guide:
-        return "Media Select Program Guide";
-    case UC_Media_Sel_Video_Phone:
-        return "Media Select Video Phone";
-    case UC_Media_Sel_Games:
-        return "Media Select Games";
-    case UC_Media_Sel_Messages:
-        return "Media Select Messages";
-    case UC_Media_Sel_CD:
-        return "Media Select CD";
-    case UC_Media_Sel_VCR:
-        return "Media Select VCR";
-    case UC_Media_Sel_Tuner:
-        return "Media Select Tuner";
-    case UC_Quit:
-        return "Quit";
-    case UC_Help:
-        return "Help";
-    case UC_Media_Sel_Tape:
-        return "Media Select Tape";
-    case UC_Media_Sel_Cable:
-        return "Media Select Cable";
-    case UC_Media_Sel_Satellite:
-        return "Media Select Satellite";
-    case UC_Media_Sel_Security:
-        return "Media Select Security";
-    case UC_Media_Sel_Home:
-        return "Media Select Home";
-    case UC_Media_Sel_Call:
-        return "Media Select Call";
-    case UC_Channel_Incr:
-        return "Channel Increment";
-    case UC_Channel_Decr:
-        return "Channel Decrement";
-    case UC_Media_Sel_SAP:
-        return "Media Select SAP";
-    case UC_VCR_Plus:
-        return "VCR Plus";
-    case UC_Once:
-        return "Once";
-    case UC_Daily:
-        return "Daily";
-    case UC_Weekly:
-        return "Weekly";
-    case UC_Monthly:
-        return "Monthly";
-    case UC_Play:
-        return "Play";
-    case UC_Pause:
-        return "Pause";
-    case UC_Record:
-        return "Record";
-    case UC_Fast_Forward:
-        return "Fast Forward";
-    case UC_Rewind:
-        return "Rewind";
-    case UC_Scan_Next_Track:
-        return "Scan Next Track";
-    case UC_Scan_Previous_Track:
-        return "Scan Previous Track";
-    case UC_Stop:
-        return "Stop";
-    case UC_Eject:
-        return "Eject";
-    case UC_Random_Play:
-        return "Random Play";
-    case UC_Sel_Disc:
-        return "Select Disc";
-    case UC_Enter_Disc:
-        return "Enter Disc";
-    case UC_Repeat:
-        return "Repeat";
-    case UC_Tracking:
-        return "Tracking";
-    case UC_Track_Normal:
-        return "Track Normal";
-    case UC_Slow_Tracking:
-        return "Slow Tracking";
-    case UC_Frame_Forward:
-        return "Frame Forward";
-    case UC_Frame_Back:
-        return "Frame Back";
-    case UC_Mark:
-        return "Mark";
-    case UC_Clear_Mark:
-        return "Clear Mark";
-    case UC_Repeat_From_Mark:
-        return "Repeat From Mark";
-    case UC_Return_To_Mark:
-        return "Return To Mark";
-    case UC_Search_Mark_Forward:
-        return "Search Mark Forward";
-    case UC_Search_Mark_Backward:
-        return "Search Mark Backwards";
-    case UC_Counter_Reset:
-        return "Counter Reset";
-    case UC_Show_Counter:
-        return "Show Counter";
-    case UC_Tracking_Incr:
-        return "Tracking Increment";
-    case UC_Tracking_Decr:
-        return "Tracking Decrement";
-    case UC_Stop_Eject:
-        return "Stop/Eject";
-    case UC_Play_Pause:
-        return "Play/Pause";
-    case UC_Play_Skip:
-        return "Play/Skip";
-    case UC_Volume:
-        return "Volume";
-    case UC_Balance:
-        return "Balance";
-    case UC_Mute:
-        return "Mute";
-    case UC_Bass:
-        return "Bass";
-    case UC_Treble:
-        return "Treble";
-    case UC_Bass_Boost:
-        return "Bass Boost";
-    case UC_Surround_Mode:
-        return "Surround Mode";
-    case UC_Loudness:
-        return "Loudness";
-    case UC_MPX:
-        return "MPX";
-    case UC_Volume_Incr:
-        return "Volume Increment";
-    case UC_Volume_Decr:
-        return "Volume Decrement";
-    case UC_Speed_Sel:
-        return "Speed Select";
-    case UC_Playback_Speed:
-        return "Playback Speed";
-    case UC_Standard_Play:
-        return "Standard Play";
-    case UC_Long_Play:
-        return "Long Play";
-    case UC_Extended_Play:
-        return "Extended Play";
-    case UC_Slow:
-        return "Slow";
-    case UC_Fan_Enable:
-        return "Fan Enable";
-    case UC_Fan_Speed:
-        return "Fan Speed";
-    case UC_Light_Enable:
-        return "Light Enable";
-    case UC_Light_ILL_Level:
-        return "Light Illumination Level";
-    case UC_Climate_Ctrl_Enable:
-        return "Climate Control Enable";
-    case UC_Room_Temperature:
-        return "Room Temperature";
-    case UC_Security_Enable:
-        return "Security Enable";
-    case UC_Fire_Alarm:
-        return "Fire Alarm";
-    case UC_Police_Alarm:
-        return "Police Alarm";
-    case UC_Proximity:
-        return "Proximity";
-    case UC_Motion:
-        return "Motion";
-    case UC_Duress_Alarm:
-        return "Duress Alarm";
-    case UC_Holdup_Alarm:
-        return "Holdup Alarm";
-    case UC_Medical_Alarm:
-        return "Medical Alarm";
-    case UC_Balance_Right:
-        return "Balance Right";
-    case UC_Balance_Left:
-        return "Balance Left";
-    case UC_Bass_Incr:
-        return "Bass Increment";
-    case UC_Bass_Decr:
-        return "Bass Decrement";
-    case UC_Treble_Incr:
-        return "Treble Increment";
-    case UC_Treble_Decr:
-        return "Treble Decrement";
-    case UC_Speaker_Sys:
-        return "Speaker System";
-    case UC_Channel_Left:
-        return "Channel Left";
-    case UC_Channel_Right:
-        return "Channel Right";
-    case UC_Channel_Center:
-        return "Channel Center";
-    case UC_Channel_Front:
-        return "Channel Front";
-    case UC_Channel_Center_Front:
-        return "Channel Center Front";
-    case UC_Channel_Side:
-        return "Channel Side";
-    case UC_Channel_Surround:
-        return "Channel Surround";
-    case UC_Channel_Low_Frequency_Enhancement:
-        return "Channel Low Frequency Enhancement";
-    case UC_Channel_Top:
-        return "Channel Top";
-    case UC_Channel_Unknown:
-        return "Channel Unknown";
-    case UC_Subchannel:
-        return "Sub-channel";
-    case UC_Subchannel_Incr:
-        return "Sub-channel Increment";
-    case UC_Subchannel_Decr:
-        return "Sub-channel Decrement";
-    case UC_Alternate_Audio_Incr:
-        return "Alternate Audio Increment";
-    case UC_Alternate_Audio_Decr:
-        return "Alternate Audio Decrement";
-    case UC_App_Launch_Btns:
-        return "Application Launch Buttons";
-    case UC_AL_Launch_Btn_Config_Tool:
-        return "AL Launch Button Configuration Tool";
-    case UC_AL_Prog_Btn_Config:
-        return "AL Programmable Button Configuration";
-    case UC_AL_Consumer_Ctrl_Config:
-        return "AL Consumer Control Configuration";
-    case UC_AL_Word_Processor:
-        return "AL Word Processor";
-    case UC_AL_Text_Editor:
-        return "AL Text Editor";
-    case UC_AL_Spreadsheet:
-        return "AL Spreadsheet";
-    case UC_AL_Graphics_Editor:
-        return "AL Graphics Editor";
-    case UC_AL_Presentation_App:
-        return "AL Presentation App";
-    case UC_AL_Database_App:
-        return "AL Database App";
-    case UC_AL_Email_Reader:
-        return "AL Email Reader";
-    case UC_AL_Newsreader:
-        return "AL Newsreader";
-    case UC_AL_Voicemail:
-        return "AL Voicemail";
-    case UC_AL_Contacts_Address_Book:
-        return "AL Contacts/Address Book";
-    case UC_AL_Calendar_Schedule:
-        return "AL Calendar/Schedule";
-    case UC_AL_Task_Project_Manager:
-        return "AL Task/Project Manager";
-    case UC_AL_Log_Journal_Timecard:
-        return "AL Log/Journal/Timecard";
-    case UC_AL_Checkbook_Finance:
-        return "AL Checkbook/Finance";
-    case UC_AL_Calculator:
-        return "AL Calculator";
-    case UC_AL_AV_Capture_Playback:
-        return "AL A/V Capture/Playback";
-    case UC_AL_Local_Machine_Browser:
-        return "AL Local Machine Browser";
-    case UC_AL_LAN_WAN_Browser:
-        return "AL LAN/WAN Browser";
-    case UC_AL_Internet_Browser:
-        return "AL Internet Browser";
-    case UC_AL_RemoteNet_ISP_Connect:
-        return "AL Remote Networking/ISP Connect";
-    case UC_AL_Net_Conference:
-        return "AL Network Conference";
-    case UC_AL_Net_Chat:
-        return "AL Network Chat";
-    case UC_AL_Telephony_Dialer:
-        return "AL Telephony/Dialer";
-    case UC_AL_Logon:
-        return "AL Logon";
-    case UC_AL_Logoff:
-        return "AL Logoff";
-    case UC_AL_Logon_Logoff:
-        return "AL Logon/Logoff";
-    case UC_AL_Terminal_Lock_Screensaver:
-        return "AL Terminal Lock/Screensaver";
-    case UC_AL_Ctrl_Panel:
-        return "AL Control Panel";
-    case UC_AL_Command_Line_Processor_Run:
-        return "AL Command Line Processor/Run";
-    case UC_AL_Process_Task_Manager:
-        return "AL Process/Task Manager";
-    case UC_AL_Sel_Task_App:
-        return "AL Select Task/Application";
-    case UC_AL_Next_Task_App:
-        return "AL Next Task/Application";
-    case UC_AL_Previous_Task_App:
-        return "AL Previous Task/Application";
-    case UC_AL_Preemptive_Halt_Task_App:
-        return "AL Preemptive Halt Task/Application";
-    case UC_AL_Integrated_Help_Center:
-        return "AL Integrated Help Center";
-    case UC_AL_Documents:
-        return "AL Documents";
-    case UC_AL_Thesaurus:
-        return "AL Thesaurus";
-    case UC_AL_Dictionary:
-        return "AL Dictionary";
-    case UC_AL_Desktop:
-        return "AL Desktop";
-    case UC_AL_Spell_Check:
-        return "AL Spell Check";
-    case UC_AL_Grammar_Check:
-        return "AL Grammar Check";
-    case UC_AL_Wireless_Status:
-        return "AL Wireless Status";
-    case UC_AL_Keyboard_Layout:
-        return "AL Keyboard Layout";
-    case UC_AL_Virus_Protection:
-        return "AL Virus Protection";
-    case UC_AL_Encryption:
-        return "AL Encryption";
-    case UC_AL_Screen_Saver:
-        return "AL Screen Saver";
-    case UC_AL_Alarms:
-        return "AL Alarms";
-    case UC_AL_Clock:
-        return "AL Clock";
-    case UC_AL_File_Browser:
-        return "AL File Browser";
-    case UC_AL_Power_Status:
-        return "AL Power Status";
-    case UC_AL_Image_Browser:
-        return "AL Image Browser";
-    case UC_AL_Audio_Browser:
-        return "AL Audio Browser";
-    case UC_AL_Movie_Browser:
-        return "AL Movie Browser";
-    case UC_AL_Digital_Rights_Manager:
-        return "AL Digital Rights Manager";
-    case UC_AL_Digital_Wallet:
-        return "AL Digital Wallet";
-    case UC_AL_Instant_Messaging:
-        return "AL Instant Messaging";
-    case UC_AL_OEM_Features_Tips_Tutorial_Browser:
-        return "AL OEM Features/Tips/Tutorial Browser";
-    case UC_AL_OEM_Help:
-        return "AL OEM Help";
-    case UC_AL_Online_Community:
-        return "AL Online Community";
-    case UC_AL_Entertainment_Content_Browser:
-        return "AL Entertainment Content Browser";
-    case UC_AL_Online_Shopping_Browser:
-        return "AL Online Shopping Browser";
-    case UC_AL_SmartCard_Information_Help:
-        return "AL SmartCard Information/Help";
-    case UC_AL_Market_Monitoror_Finance_Browser:
-        return "AL Market Monitor/Finance Browser";
-    case UC_AL_Customized_Corporate_News_Browser:
-        return "AL Customized Corporate News Browser";
-    case UC_AL_Online_Activity_Browser:
-        return "AL Online Activity Browser";
-    case UC_AL_Research_Search_Browser:
-        return "AL Research/Search Browser";
-    case UC_AL_Audio_Player:
-        return "AL Audio Player";
-    case UC_Generic_GUI_App_Ctrls:
-        return "Generic GUI Application Controls";
-    case UC_AC_New:
-        return "AC New";
-    case UC_AC_Open:
-        return "AC Open";
-    case UC_AC_Close:
-        return "AC Close";
-    case UC_AC_Exit:
-        return "AC Exit";
-    case UC_AC_Maximize:
-        return "AC Maximize";
-    case UC_AC_Minimize:
-        return "AC Minimize";
-    case UC_AC_Save:
-        return "AC Save";
-    case UC_AC_Print:
-        return "AC Print";
-    case UC_AC_Properties:
-        return "AC Properties";
-    case UC_AC_Undo:
-        return "AC Undo";
-    case UC_AC_Copy:
-        return "AC Copy";
-    case UC_AC_Cut:
-        return "AC Cut";
-    case UC_AC_Paste:
-        return "AC Paste";
-    case UC_AC_Sel_All:
-        return "AC Select All";
-    case UC_AC_Find:
-        return "AC Find";
-    case UC_AC_Find_and_Replace:
-        return "AC Find and Replace";
-    case UC_AC_Search:
-        return "AC Search";
-    case UC_AC_Go_To:
-        return "AC Go To";
-    case UC_AC_Home:
-        return "AC Home";
-    case UC_AC_Back:
-        return "AC Back";
-    case UC_AC_Forward:
-        return "AC Forward";
-    case UC_AC_Stop:
-        return "AC Stop";
-    case UC_AC_Refresh:
-        return "AC Refresh";
-    case UC_AC_Previous_Link:
-        return "AC Previous Link";
-    case UC_AC_Next_Link:
-        return "AC Next Link";
-    case UC_AC_Bookmarks:
-        return "AC Bookmarks";
-    case UC_AC_History:
-        return "AC History";
-    case UC_AC_Subscriptions:
-        return "AC Subscriptions";
-    case UC_AC_Zoom_In:
-        return "AC Zoom In";
-    case UC_AC_Zoom_Out:
-        return "AC Zoom Out";
-    case UC_AC_Zoom:
-        return "AC Zoom";
-    case UC_AC_Full_Screen_View:
-        return "AC Full Screen View";
-    case UC_AC_Normal_View:
-        return "AC Normal View";
-    case UC_AC_View_Toggle:
-        return "AC View Toggle";
-    case UC_AC_Scroll_Up:
-        return "AC Scroll Up";
-    case UC_AC_Scroll_Down:
-        return "AC Scroll Down";
-    case UC_AC_Scroll:
-        return "AC Scroll";
-    case UC_AC_Pan_Left:
-        return "AC Pan Left";
-    case UC_AC_Pan_Right:
-        return "AC Pan Right";
-    case UC_AC_Pan:
-        return "AC Pan";
-    case UC_AC_New_Window:
-        return "AC New Window";
-    case UC_AC_Tile_Horizontally:
-        return "AC Tile Horizontally";
-    case UC_AC_Tile_Vertically:
-        return "AC Tile Vertically";
-    case UC_AC_Format:
-        return "AC Format";
-    case UC_AC_Edit:
-        return "AC Edit";
-    case UC_AC_Bold:
-        return "AC Bold";
-    case UC_AC_Italics:
-        return "AC Italics";
-    case UC_AC_Underline:
-        return "AC Underline";
-    case UC_AC_Strikethrough:
-        return "AC Strikethrough";
-    case UC_AC_Subscript:
-        return "AC Subscript";
-    case UC_AC_Superscript:
-        return "AC Superscript";
-    case UC_AC_All_Caps:
-        return "AC All Caps";
-    case UC_AC_Rotate:
-        return "AC Rotate";
-    case UC_AC_Resize:
-        return "AC Resize";
-    case UC_AC_Flip_Horiz:
-        return "AC Flip horizontal";
-    case UC_AC_Flip_Verti:
-        return "AC Flip Vertical";
-    case UC_AC_Mirror_Horizontal:
-        return "AC Mirror Horizontal";
-    case UC_AC_Mirror_Vertical:
-        return "AC Mirror Vertical";
-    case UC_AC_Font_Sel:
-        return "AC Font Select";
-    case UC_AC_Font_Color:
-        return "AC Font Color";
-    case UC_AC_Font_Size:
-        return "AC Font Size";
-    case UC_AC_Justify_Left:
-        return "AC Justify Left";
-    case UC_AC_Justify_Center_H:
-        return "AC Justify Center H";
-    case UC_AC_Justify_Right:
-        return "AC Justify Right";
-    case UC_AC_Justify_Block_H:
-        return "AC Justify Block H";
-    case UC_AC_Justify_Top:
-        return "AC Justify Top";
-    case UC_AC_Justify_Center_V:
-        return "AC Justify Center V";
-    case UC_AC_Justify_Bottom:
-        return "AC Justify Bottom";
-    case UC_AC_Justify_Block_V:
-        return "AC Justify Block V";
-    case UC_AC_Indent_Decr:
-        return "AC Indent Decrease";
-    case UC_AC_Indent_Incr:
-        return "AC Indent Increase";
-    case UC_AC_Numbered_List:
-        return "AC Numbered List";
-    case UC_AC_Restart_Numbering:
-        return "AC Restart Numbering";
-    case UC_AC_Bulleted_List:
-        return "AC Bulleted List";
-    case UC_AC_Promote:
-        return "AC Promote";
-    case UC_AC_Demote:
-        return "AC Demote";
-    case UC_AC_Yes:
-        return "AC Yes";
-    case UC_AC_No:
-        return "AC No";
-    case UC_AC_Cancel:
-        return "AC Cancel";
-    case UC_AC_Catalog:
-        return "AC Catalog";
-    case UC_AC_BuyorCheckout:
-        return "AC Buy/Checkout";
-    case UC_AC_Add_to_Cart:
-        return "AC Add to Cart";
-    case UC_AC_Expand:
-        return "AC Expand";
-    case UC_AC_Expand_All:
-        return "AC Expand All";
-    case UC_AC_Collapse:
-        return "AC Collapse";
-    case UC_AC_Collapse_All:
-        return "AC Collapse All";
-    case UC_AC_Print_Preview:
-        return "AC Print Preview";
-    case UC_AC_Paste_Special:
-        return "AC Paste Special";
-    case UC_AC_Insert_Mode:
-        return "AC Insert Mode";
-    case UC_AC_Delete:
-        return "AC Delete";
-    case UC_AC_Lock:
-        return "AC Lock";
-    case UC_AC_Unlock:
-        return "AC Unlock";
-    case UC_AC_Protect:
-        return "AC Protect";
-    case UC_AC_Unprotect:
-        return "AC Unprotect";
-    case UC_AC_Attach_Comment:
-        return "AC Attach Comment";
-    case UC_AC_Delete_Comment:
-        return "AC Delete Comment";
-    case UC_AC_View_Comment:
-        return "AC View Comment";
-    case UC_AC_Sel_Word:
-        return "AC Select Word";
-    case UC_AC_Sel_Sentence:
-        return "AC Select Sentence";
-    case UC_AC_Sel_Paragraph:
-        return "AC Select Paragraph";
-    case UC_AC_Sel_Column:
-        return "AC Select Column";
-    case UC_AC_Sel_Row:
-        return "AC Select Row";
-    case UC_AC_Sel_Table:
-        return "AC Select Table";
-    case UC_AC_Sel_Object:
-        return "AC Select Object";
-    case UC_AC_Redo_Repeat:
-        return "AC Redo/Repeat";
-    case UC_AC_Sort:
-        return "AC Sort";
-    case UC_AC_Sort_Ascending:
-        return "AC Sort Ascending";
-    case UC_AC_Sort_Descending:
-        return "AC Sort Descending";
-    case UC_AC_Filter:
-        return "AC Filter";
-    case UC_AC_Set_Clock:
-        return "AC Set Clock";
-    case UC_AC_View_Clock:
-        return "AC View Clock";
-    case UC_AC_Sel_Time_Zone:
-        return "AC Select Time Zone";
-    case UC_AC_Edit_Time_Zones:
-        return "AC Edit Time Zones";
-    case UC_AC_Set_Alarm:
-        return "AC Set Alarm";
-    case UC_AC_Clear_Alarm:
-        return "AC Clear Alarm";
-    case UC_AC_Snooze_Alarm:
-        return "AC Snooze Alarm";
-    case UC_AC_Reset_Alarm:
-        return "AC Reset Alarm";
-    case UC_AC_Synchronize:
-        return "AC Synchronize";
-    case UC_AC_Send_or_Recv:
-        return "AC Send/Receive";
-    case UC_AC_Send_To:
-        return "AC Send To";
-    case UC_AC_Reply:
-        return "AC Reply";
-    case UC_AC_Reply_All:
-        return "AC Reply All";
-    case UC_AC_Forward_Msg:
-        return "AC Forward Msg";
-    case UC_AC_Send:
-        return "AC Send";
-    case UC_AC_Attach_File:
-        return "AC Attach File";
-    case UC_AC_Upload:
-        return "AC Upload";
-    case UC_AC_Download_Save_As:
-        return "AC Download (Save Target As)";
-    case UC_AC_Set_Borders:
-        return "AC Set Borders";
-    case UC_AC_Insert_Row:
-        return "AC Insert Row";
-    case UC_AC_Insert_Column:
-        return "AC Insert Column";
-    case UC_AC_Insert_File:
-        return "AC Insert File";
-    case UC_AC_Insert_Picture:
-        return "AC Insert Picture";
-    case UC_AC_Insert_Object:
-        return "AC Insert Object";
-    case UC_AC_Insert_Symbol:
-        return "AC Insert Symbol";
-    case UC_AC_Save_and_Close:
-        return "AC Save and Close";
-    case UC_AC_Rename:
-        return "AC Rename";
-    case UC_AC_Merge:
-        return "AC Merge";
-    case UC_AC_Split:
-        return "AC Split";
-    case UC_AC_Distribute_Horiz:
-        return "AC Distribute Horizontally";
-    case UC_AC_Distribute_Verti:
-        return "AC Distribute Vertically";
-    default:
-        return "Unknown";
-    }
-}
-
-const char *ri_Digitizer(int32_t usage)
-{
-    switch(usage)
-    {
-    case D_Digitizer:
-        return "Digitizer";
-    case D_Pen:
-        return "Pen";
-    case D_Light_Pen:
-        return "Light Pen";
-    case D_Touch_Screen:
-        return "Touch Screen";
-    case D_Touch_Pad:
-        return "Touch Pad";
-    case D_White_Board:
-        return "White Board";
-    case D_Coordinate_Measuring_Machine:
-        return "Coordinate Measuring Machine";
-    case D_4D_Digitizer:
-        return "3D Digitizer";
-    case D_Stereo_Plotter:
-        return "Stereo Plotter";
-    case D_Articulated_Arm:
-        return "Articulated Arm";
-    case D_Armature:
-        return "Armature";
-    case D_Multiple_Point_Digitizer:
-        return "Multiple Point Digitizer ";
-    case D_Free_Space_Wand:
-        return "Free Space Wand";
-    case D_Stylus:
-        return "Stylus";
-    case D_Puck:
-        return "Puck";
-    case D_Finger:
-        return "Finger";
-    case D_Tip_Pressure:
-        return "Tip Pressure";
-    case D_Barrel_Pressure:
-        return "Barrel Pressure";
-    case D_In_Range:
-        return "In Range";
-    case D_Touch:
-        return "Touch";
-    case D_Untouch:
-        return "Untouch";
-    case D_Tap:
-        return "Tap";
-    case D_Quality:
-        return "Quality";
-    case D_Data_Valid:
-        return "Data Valid";
-    case D_Transducer_Index:
-        return "Transducer Index";
-    case D_Tablet_Function_Keys:
-        return "Tablet Function Keys";
-    case D_Program_Change_Keys:
-        return "Program Change Keys";
-    case D_Battery_Strength:
-        return "Battery Strength";
-    case D_Invert:
-        return "Invert";
-    case D_X_Tilt:
-        return "X Tilt";
-    case D_Y_Tilt:
-        return "Y Tilt";
-    case D_Azimuth:
-        return "Azimuth";
-    case D_Altitude:
-        return "Altitude ";
-    case D_Twist:
-        return "Twist ";
-    case D_Tip_Switch:
-        return "Tip Switch";
-    case D_Secondary_Tip_Switch:
-        return "Secondary Tip Switch ";
-    case D_Barrel_Switch:
-        return "Barrel Switch ";
-    case D_Eraser:
-        return "Eraser";
-    case D_Tablet_Pick:
-        return "Tablet Pick";
-    default:
-        return "Unknown";
-    }
-}
-
-const char *ri_PIDPage(int32_t usage)
-{
-    switch(usage)
-    {
-    /* HID 1.11 Chapter 3 Table 1 says that
-    ** USB Physical Interface Device definitions
-    ** for force feedback and related decvices.
-    ** This document didn't describe details.
-    */
-    default:
-        return "Unknown";
-    }
-}
+/* All the names, stored back to back in a single pool; the usage table
+** refers to them by offset.
+*/
+typedef struct {
+#define NAME(id, str) char id[sizeof(str)];
+#include "report_usage_names.h"
+#undef NAME
+} UsageNamePool;
 
-const char *ri_Unicode(int32_t usage)
-{
-    switch(usage)
-    {
-        /* see HID 1.11 Chapter 17
-        */
-    default:
-        return "Unknown";
-    }
-}
+static const UsageNamePool s_names = {
+#define NAME(id, str) str,
+#include "report_usage_names.h"
+#undef NAME
+};
 
-const char *ri_AlphanumericDisplay(int32_t usage)
-{
-    switch(usage)
-    {
-    case AD_Alphanumeric_Display:
-        return "Alphanumeric Display";
-    case AD_Bitmapped_Display:
-        return "Bitmapped Display";
-    case AD_Display_Attributes_Report:
-        return "Display Attributes Report";
-    case AD_ASCII_Character_Set:
-        return "ASCII Character Set";
-    case AD_Data_Read_Back:
-        return "Data Read Back";
-    case AD_Font_Read_Back:
-        return "Font Read Back";
-    case AD_Display_Control_Report:
-        return "Display Control Report";
-    case AD_Clear_Display:
-        return "Clear Display";
-    case AD_Display_Enable:
-        return "Display Enable";
-    case AD_Screen_Saver_Delay:
-        return "Screen Saver Delay";
-    case AD_Screen_Saver_Enable:
-        return "Screen Saver Enable";
-    case AD_Vertical_Scroll:
-        return "Vertical Scroll";
-    case AD_Horizontal_Scroll:
-        return "Horizontal Scroll";
-    case AD_Character_Report:
-        return "Character Report";
-    case AD_Display_Data:
-        return "Display Data";
-    case AD_Display_Status:
-        return "Display Status";
-    case AD_Stat_Not_Ready:
-        return "Stat Not Ready";
-    case AD_Stat_Ready:
-        return "Stat Ready";
-    case AD_Err_Not_a_loadable_character:
-        return "Err Not a loadable character";
-    case AD_Err_Font_data_cannot_be_read:
-        return "Err Font data cannot be read";
-    case AD_Cursor_Position_Report:
-        return "Cursor Position Report";
-    case AD_Row:
-        return "Row";
-    case AD_Column:
-        return "Column";
-    case AD_Rows:
-        return "Rows";
-    case AD_Columns:
-        return "Columns";
-    case AD_Cursor_Pixel_Positioning:
-        return "Cursor Pixel Positioning";
-    case AD_Cursor_Mode:
-        return "Cursor Mode";
-    case AD_Cursor_Enable:
-        return "Cursor Enable";
-    case AD_Cursor_Blink:
-        return "Cursor Blink";
-    case AD_Font_Report:
-        return "Font Report";
-    case AD_Font_Data:
-        return "Font Data";
-    case AD_Character_Width:
-        return "Character Width";
-    case AD_Character_Height:
-        return "Character Height";
-    case AD_Character_Spacing_Horizontal:
-        return "Character Spacing Horizontal";
-    case AD_Character_Spacing_Vertical:
-        return "Character Spacing Vertical";
-    case AD_Unicode_Character_Set:
-        return "Unicode Character Set";
-    case AD_Font_7_Segment:
-        return "Font 7-Segment";
-    case AD_7_Segment_Direct_Map:
-        return "7-Segment Direct Map";
-    case AD_Font_14_Segment:
-        return "Font 14-Segment";
-    case AD_14_Segment_Direct_Map:
-        return "14-Segment Direct Map";
-    case AD_Display_Brightness:
-        return "Display Brightness";
-    case AD_Display_Contrast:
-        return "Display Contrast";
-    case AD_Character_Attribute:
-        return "Character Attribute";
-    case AD_Attribute_Readback:
-        return "Attribute Readback";
-    case AD_Attribute_Data:
-        return "Attribute Data";
-    case AD_Char_Attr_Enhance:
-        return "Char Attr Enhance";
-    case AD_Char_Attr_Underline:
-        return "Char Attr Underline";
-    case AD_Char_Attr_Blink:
-        return "Char Attr Blink";
-    case AD_Bitmap_Size_X:
-        return "Bitmap Size X";
-    case AD_Bitmap_Size_Y:
-        return "Bitmap Size Y";
-    case AD_Bit_Depth_Format:
-        return "Bit Depth Format";
-    case AD_Display_Orientation:
-        return "Display Orientation";
-    case AD_Palette_Report:
-        return "Palette Report";
-    case AD_Palette_Data_Size:
-        return "Palette Data Size";
-    case AD_Palette_Data_Offset:
-        return "Palette Data Offset";
-    case AD_Palette_Data:
-        return "Palette Data";
-    case AD_Blit_Report:
-        return "Blit Report";
-    case AD_Blit_Rectangle_X1:
-        return "Blit Rectangle X1";
-    case AD_Blit_Rectangle_Y1:
-        return "Blit Rectangle Y1";
-    case AD_Blit_Rectangle_X2:
-        return "Blit Rectangle X2";
-    case AD_Blit_Rectangle_Y2:
-        return "Blit Rectangle Y2";
-    case AD_Blit_Data:
-        return "Blit Data";
-    case AD_Soft_Button:
-        return "Soft Button";
-    case AD_Soft_Button_ID:
-        return "Soft Button ID";
-    case AD_Soft_Button_Side:
-        return "Soft Button Side";
-    case AD_Soft_Button_Offset_1:
-        return "Soft Button Offset 1";
-    case AD_Soft_Button_Offset_2:
-        return "Soft Button Offset 2";
-    case AD_Soft_Button_Report:
-        return "Soft Button Report";
-    default:
-        return "Unknown";
-    }
-}
+typedef struct {
+    uint32_t key; /* page << 16 | usage */
+    uint16_t name; /* offset in s_names */
+} UsageName;
 
-const char *ri_MedicalInstruments(int32_t usage)
-{
-    switch(usage)
-    {
-    case MI_Medical_Ultrasound:
-        return "Medical Ultrasound";
-    case MI_VCR_Acquisition:
-        return "VCR/Acquisition";
-    case MI_Freeze_Thaw:
-        return "Freeze/Thaw";
-    case MI_Clip_Store:
-        return "Clip Store";
-    case MI_Update:
-        return "Update";
-    case MI_Next:
-        return "Next";
-    case MI_Save:
-        return "Save";
-    case MI_Print:
-        return "Print";
-    case MI_Microphone_Enable:
-        return "Microphone Enable";
-    case MI_Cine:
-        return "Cine";
-    case MI_Transmit_Power:
-        return "Transmit Power";
-    case MI_Volume:
-        return "Volume";
-    case MI_Focus:
-        return "Focus";
-    case MI_Depth:
-        return "Depth";
-    case MI_Soft_Step_Primary:
-        return "Soft Step - Primary";
-    case MI_Soft_Step_Secondary:
-        return "Soft Step - Secondary";
-    case MI_Depth_Gain_Compensation:
-        return "Depth Gain Compensation";
-    case MI_Zoom_Select:
-        return "Zoom Select";
-    case MI_Zoom_Adjust:
-        return "Zoom Adjust";
-    case MI_Spectral_Doppler_Mode_Select:
-        return "Spectral Doppler Mode Select";
-    case MI_Spectral_Doppler_Adjust:
-        return "Spectral Doppler Adjust";
-    case MI_Color_Doppler_Mode_Select:
-        return "Color Doppler Mode Select";
-    case MI_Color_Doppler_Adjust:
-        return "Color Doppler Adjust";
-    case MI_Motion_Mode_Select:
-        return "Motion Mode Select";
-    case MI_Motion_Mode_Adjust:
-        return "Motion Mode Adjust";
-    case MI_2D_Mode_Select:
-        return "2-D Mode Select";
-    case MI_2D_Mode_Adjust:
-        return "2-D Mode Adjust";
-    case MI_Soft_Control_Select:
-        return "Soft Control Select";
-    case MI_Soft_Control_Adjust:
-        return "Soft Control Adjust";
-    default:
-        return "Unknown";
-    }
-}
+#define USAGE(page, usage, id) \
+    { ((uint32_t)(page) << 16) | (usage), offsetof(UsageNamePool, id) }
 
-const char *ri_Monitor(int32_t usage)
-{
-    switch(usage)
-    {
-    /* HID 1.11 Chapter 3 Table 1 says that
-    ** USB Device Class Definitrion for Monitor Device
-    ** This document didn't describe details.
-    */
-    default:
-        return "Unknown";
-    }
-}
+/* Sorted by page, then by usage */
+static const UsageName s_usages[] = {
+    USAGE(UP_Generic_Desktop, GD_Pointer, Pointer),
+    USAGE(UP_Generic_Desktop, GD_Mouse, Mouse),
+    USAGE(UP_Generic_Desktop, GD_Joystick, Joystick),
+    USAGE(UP_Generic_Desktop, GD_Game_Pad, Game_Pad),
+    USAGE(UP_Generic_Desktop, GD_Keyboard, Keyboard),
+    USAGE(UP_Generic_Desktop, GD_Keypad, Keypad),
+    USAGE(UP_Generic_Desktop, GD_Multiaxis_Controller, Multi_axis_Controller),
+    USAGE(UP_Generic_Desktop, GD_Tablet_PC_Sys_Controls, Tablet_PC_System_Controls),
+    USAGE(UP_Generic_Desktop, GD_X, X),
+    USAGE(UP_Generic_Desktop, GD_Y, Y),
+    USAGE(UP_Generic_Desktop, GD_Z, Z),
+    USAGE(UP_Generic_Desktop, GD_Rx, Rx),
+    USAGE(UP_Generic_Desktop, GD_Ry, Ry),
+    USAGE(UP_Generic_Desktop, GD_Rz, Rz),
+    USAGE(UP_Generic_Desktop, GD_Slider, Slider),
+    USAGE(UP_Generic_Desktop, GD_Dial, Dial),
+    USAGE(UP_Generic_Desktop, GD_Wheel, Wheel),
+    USAGE(UP_Generic_Desktop, GD_Hat_Switch, Switch),
+    USAGE(UP_Generic_Desktop, GD_Counted_Buffer, Counted_Buffer),
+    USAGE(UP_Generic_Desktop, GD_Byte_Count, Byte_Count),
+    USAGE(UP_Generic_Desktop, GD_Motion_Wakeup, Motion_Wakeup),
+    USAGE(UP_Generic_Desktop, GD_Start, Start),
+    USAGE(UP_Generic_Desktop, GD_Select, Select),
+    USAGE(UP_Generic_Desktop, GD_Vx, Vx),
+    USAGE(UP_Generic_Desktop, GD_Vy, Vy),
+    USAGE(UP_Generic_Desktop, GD_Vz, Vz),
+    USAGE(UP_Generic_Desktop, GD_Vbrx, Vbrx),
+    USAGE(UP_Generic_Desktop, GD_Vbry, Vbry),
+    USAGE(UP_Generic_Desktop, GD_Vbrz, Vbrz),
+    USAGE(UP_Generic_Desktop, GD_Vno, Vno),
+    USAGE(UP_Generic_Desktop, GD_Feature_Notification, Feature_Notification),
+    USAGE(UP_Generic_Desktop, GD_Resolution_Multiplier, Resolution_Multiplier),
+    USAGE(UP_Generic_Desktop, GD_Sys_Control, System_Control),
+    USAGE(UP_Generic_Desktop, GD_Sys_Power_Down, System_Power_Down),
+    USAGE(UP_Generic_Desktop, GD_Sys_Sleep, System_Sleep),
+    USAGE(UP_Generic_Desktop, GD_Sys_Wake_Up, System_Wake_Up),
+    USAGE(UP_Generic_Desktop, GD_Sys_Context_Menu, System_Context_Menu),
+    USAGE(UP_Generic_Desktop, GD_Sys_Main_Menu, System_Main_Menu),
+    USAGE(UP_Generic_Desktop, GD_Sys_App_Menu, System_App_Menu),
+    USAGE(UP_Generic_Desktop, GD_Sys_Menu_Help, System_Menu_Help),
+    USAGE(UP_Generic_Desktop, GD_Sys_Menu_Exit, System_Menu_Exit),
+    USAGE(UP_Generic_Desktop, GD_Sys_Menu_Select, System_Menu_Select),
+    USAGE(UP_Generic_Desktop, GD_Sys_Menu_Right, System_Menu_Right),
+    USAGE(UP_Generic_Desktop, GD_Sys_Menu_Left, System_Menu_Left),
+    USAGE(UP_Generic_Desktop, GD_Sys_Menu_Up, System_Menu_Up),
+    USAGE(UP_Generic_Desktop, GD_Sys_Menu_Down, System_Menu_Down),
+    USAGE(UP_Generic_Desktop, GD_Sys_Cold_Restart, System_Cold_Restart),
+    USAGE(UP_Generic_Desktop, GD_Sys_Warm_Restart, System_Warm_Restart),
+    USAGE(UP_Generic_Desktop, GD_D_pad_Up, D_pad_Up),
+    USAGE(UP_Generic_Desktop, GD_D_pad_Down, D_pad_Down),
+    USAGE(UP_Generic_Desktop, GD_D_pad_Right, D_pad_Right),
+    USAGE(UP_Generic_Desktop, GD_D_pad_Left, D_pad_Left),
+    USAGE(UP_Generic_Desktop, GD_Sys_Dock, System_Dock),
+    USAGE(UP_Generic_Desktop, GD_Sys_Undock, SYstem_Undock),
+    USAGE(UP_Generic_Desktop, GD_Sys_Setup, System_Setup),
+    USAGE(UP_Generic_Desktop, GD_Sys_Break, System_Break),
+    USAGE(UP_Generic_Desktop, GD_Sys_Debugger_Break, System_Debugger_Break),
+    USAGE(UP_Generic_Desktop, GD_Application_Break, Application_Break),
+    USAGE(UP_Generic_Desktop, GD_Application_Debugger_Break, Application_Debugger_Break),
+    USAGE(UP_Generic_Desktop, GD_Sys_Speaker_Mute, System_Speaker_Mute),
+    USAGE(UP_Generic_Desktop, GD_Sys_Hibernate, System_Hibernate),
+    USAGE(UP_Generic_Desktop, GD_Sys_Display_Invert, System_Display_Invert),
+    USAGE(UP_Generic_Desktop, GD_Sys_Display_Internal, System_Display_Internal),
+    USAGE(UP_Generic_Desktop, GD_Sys_Display_External, System_Display_External),
+    USAGE(UP_Generic_Desktop, GD_Sys_Display_Both, System_Display_Both),
+    USAGE(UP_Generic_Desktop, GD_Sys_Display_Dual, System_Display_Dual),
+    USAGE(UP_Generic_Desktop, GD_Sys_Display_Toggle, System_Display_Toggle),
+    USAGE(UP_Generic_Desktop, GD_Sys_Display_Swap, System_Display_Swap),
+    USAGE(UP_Generic_Desktop, GD_Sys_Display_LCD_Autoscale, System_Display_LCD_Autoscale),
+    USAGE(UP_Simulation_Controls, SC_SimuDev_Flight, Flight_Simulation_Device),
+    USAGE(UP_Simulation_Controls, SC_SimuDev_Automobile, Automobile_Simulation_Device),
+    USAGE(UP_Simulation_Controls, SC_SimuDev_Tank, Tank_Simulation_Device),
+    USAGE(UP_Simulation_Controls, SC_SimuDev_Spaceship, Spaceship_Simulation_Device),
+    USAGE(UP_Simulation_Controls, SC_SimuDev_Submarine, Submarine_Simulation_Device),
+    USAGE(UP_Simulation_Controls, SC_SimuDev_Sailing, Sailing_Simulation_Device),
+    USAGE(UP_Simulation_Controls, SC_SimuDev_Motorcycle, Motorcycle_Simulation_Device),
+    USAGE(UP_Simulation_Controls, SC_SimuDev_Sports, Sports_Simulation_Device),
+    USAGE(UP_Simulation_Controls, SC_SimuDev_Airplane, Airplane_Simulation_Device),
+    USAGE(UP_Simulation_Controls, SC_SimuDev_Helicopter, Helicopter_Simulation_Device),
+    USAGE(UP_Simulation_Controls, SC_SimuDev_MagicCarpet, MagicCarpet_Simulation_Device),
+    USAGE(UP_Simulation_Controls, SC_SimuDev_Bicycle, Bicycle_Simulation_Device),
+    USAGE(UP_Simulation_Controls, SC_Flight_Control_Stick, Flight_Control_Stick),
+    USAGE(UP_Simulation_Controls, SC_Flilght_Stick, Flilght_Stick),
+    USAGE(UP_Simulation_Controls, SC_Cyclic_Control, Cyclic_Control),
+    USAGE(UP_Simulation_Controls, SC_Cyclic_Trim, Cyclic_Trim),
+    USAGE(UP_Simulation_Controls, SC_Flight_Yoke, Flight_Yoke),
+    USAGE(UP_Simulation_Controls, SC_Track_Control, Track_Control),
+    USAGE(UP_Simulation_Controls, SC_Aileron, Aileron),
+    USAGE(UP_Simulation_Controls, SC_Aileron_Trim, Aileron_Trim),
+    USAGE(UP_Simulation_Controls, SC_Anti_Torque_Control, Anti_Torque_Control),
+    USAGE(UP_Simulation_Controls, SC_Autopilot_Enable, Autopilot_Enable),
+    USAGE(UP_Simulation_Controls, SC_Chaff_Release, Chaff_Release),
+    USAGE(UP_Simulation_Controls, SC_Collective_Control, Collective_Control),
+    USAGE(UP_Simulation_Controls, SC_Dive_Brake, Dive_Brake),
+    USAGE(UP_Simulation_Controls, SC_Electronic_Countermeasures, Electronic_Countermeasures),
+    USAGE(UP_Simulation_Controls, SC_Elevator, Elevator),
+    USAGE(UP_Simulation_Controls, SC_Elevator_Trim, Elevator_Trim),
+    USAGE(UP_Simulation_Controls, SC_Rudder, Rudder),
+    USAGE(UP_Simulation_Controls, SC_Throttle, Throttle),
+    USAGE(UP_Simulation_Controls, SC_Flight_Communications, Flight_Communications),
+    USAGE(UP_Simulation_Controls, SC_Flare_Release, Flare_Release),
+    USAGE(UP_Simulation_Controls, SC_Landing_Gear, Landing_Gear),
+    USAGE(UP_Simulation_Controls, SC_Toe_Brake, Toe_Brake),
+    USAGE(UP_Simulation_Controls, SC_Trigger, Trigger),
+    USAGE(UP_Simulation_Controls, SC_Weapons_Arm, Weapons_Arm),
+    USAGE(UP_Simulation_Controls, SC_Weapons_Select, Weapons_Select),
+    USAGE(UP_Simulation_Controls, SC_Wing_Flaps, Wing_Flaps),
+    USAGE(UP_Simulation_Controls, SC_Accelerator, Accelerator),
+    USAGE(UP_Simulation_Controls, SC_Brake, Brake),
+    USAGE(UP_Simulation_Controls, SC_Clutch, Clutch),
+    USAGE(UP_Simulation_Controls, SC_Shifter, Shifter),
+    USAGE(UP_Simulation_Controls, SC_Steering, Steering),
+    USAGE(UP_Simulation_Controls, SC_Turret_Direction, Turret_Direction),
+    USAGE(UP_Simulation_Controls, SC_Barrel_Elevation, Barrel_Elevation),
+    USAGE(UP_Simulation_Controls, SC_Dive_Plane, Dive_Plane),
+    USAGE(UP_Simulation_Controls, SC_Ballast, Ballast),
+    USAGE(UP_Simulation_Controls, SC_Bicycle_Crank, Bicycle_Crank),
+    USAGE(UP_Simulation_Controls, SC_Handle_Bars, Handle_Bars),
+    USAGE(UP_Simulation_Controls, SC_Front_Brake, Front_Brake),
+    USAGE(UP_Simulation_Controls, SC_Rear_Brake, Rear_Brake),
+    USAGE(UP_VR_Controls, VR_Belt, Belt),
+    USAGE(UP_VR_Controls, VR_Body_Suit, Body_Suit),
+    USAGE(UP_VR_Controls, VR_Flexor, Flexor),
+    USAGE(UP_VR_Controls, VR_Glove, Glove),
+    USAGE(UP_VR_Controls, VR_Head_Tracker, Head_Tracker),
+    USAGE(UP_VR_Controls, VR_Head_Mounted_Display, Head_Mounted_Display),
+    USAGE(UP_VR_Controls, VR_Hand_Tracker, Hand_Tracker),
+    USAGE(UP_VR_Controls, VR_Oculometer, Oculometer),
+    USAGE(UP_VR_Controls, VR_Vest, Vest),
+    USAGE(UP_VR_Controls, VR_Animatronic_Device, Animatronic_Device),
+    USAGE(UP_VR_Controls, VR_Stereo_Enable, Stereo_Enable),
+    USAGE(UP_VR_Controls, VR_Display_Enable, Display_Enable),
+    USAGE(UP_Sport_Controls, SpC_Baseball_Bat, Baseball_Bat),
+    USAGE(UP_Sport_Controls, SpC_Golf_Club, Golf_Club),
+    USAGE(UP_Sport_Controls, SpC_Rowing_Machine, Rowing_Machine),
+    USAGE(UP_Sport_Controls, SpC_Treadmill, Treadmill),
+    USAGE(UP_Sport_Controls, SpC_Oar, Oar),
+    USAGE(UP_Sport_Controls, SpC_Slope, Slope),
+    USAGE(UP_Sport_Controls, SpC_Rate, Rate),
+    USAGE(UP_Sport_Controls, SpC_Stick_Speed, Stick_Speed),
+    USAGE(UP_Sport_Controls, SpC_Stick_Face_Angle, Stick_Face_Angle),
+    USAGE(UP_Sport_Controls, SpC_Stick_HeelorToe, Stick_HeelorToe),
+    USAGE(UP_Sport_Controls, SpC_Stick_Follow_Through, Stick_Follow_Through),
+    USAGE(UP_Sport_Controls, SpC_Stick_Tempo, Stick_Tempo),
+    USAGE(UP_Sport_Controls, SpC_Stick_Type, Stick_Type),
+    USAGE(UP_Sport_Controls, SpC_Stick_Height, Stick_Height),
+    USAGE(UP_Sport_Controls, SpC_Putter, Putter),
+    USAGE(UP_Sport_Controls, SpC_Iron_1, Iron),
+    USAGE(UP_Sport_Controls, SpC_Iron_2, Iron),
+    USAGE(UP_Sport_Controls, SpC_Iron_3, Iron),
+    USAGE(UP_Sport_Controls, SpC_Iron_4, Iron),
+    USAGE(UP_Sport_Controls, SpC_Iron_5, Iron),
+    USAGE(UP_Sport_Controls, SpC_Iron_6, Iron),
+    USAGE(UP_Sport_Controls, SpC_Iron_7, Iron),
+    USAGE(UP_Sport_Controls, SpC_Iron_8, Iron),
+    USAGE(UP_Sport_Controls, SpC_Iron_9, Iron),
+    USAGE(UP_Sport_Controls, SpC_Iron_10, Iron),
+    USAGE(UP_Sport_Controls, SpC_Iron_11, Iron),
+    USAGE(UP_Sport_Controls, SpC_Sand_Wedge, Sand_Wedge),
+    USAGE(UP_Sport_Controls, SpC_Loft_Wedge, Loft_Wedge),
+    USAGE(UP_Sport_Controls, SpC_Power_Wedge, Power_Wedge),
+    USAGE(UP_Sport_Controls, SpC_Wood_1, Wood),
+    USAGE(UP_Sport_Controls, SpC_Wood_3, Wood),
+    USAGE(UP_Sport_Controls, SpC_Wood_5, Wood),
+    USAGE(UP_Sport_Controls, SpC_Wood_7, Wood),
+    USAGE(UP_Sport_Controls, SpC_Wood_9, Wood),
+    USAGE(UP_Game_Controls, GC_3D_Game_Controller, N3D_Game_Controller),
+    USAGE(UP_Game_Controls, GC_Pinball_Device, Pinball_Device),
+    USAGE(UP_Game_Controls, GC_Gun_Device, Gun_Device),
+    USAGE(UP_Game_Controls, GC_Point_of_View, Point_of_View),
+    USAGE(UP_Game_Controls, GC_Turn_Right_Left, Turn_Right_Left),
+    USAGE(UP_Game_Controls, GC_Pitch_Forward_Backward, Pitch_Forward_Backward),
+    USAGE(UP_Game_Controls, GC_Roll_Right_Left, Roll_Right_Left),
+    USAGE(UP_Game_Controls, GC_Move_Right_Left, Move_Right_Left),
+    USAGE(UP_Game_Controls, GC_Move_Forward_Backward, Move_Forward_Backward),
+    USAGE(UP_Game_Controls, GC_Move_Up_Down, Move_Up_Down),
+    USAGE(UP_Game_Controls, GC_Lean_Right_Left, Lean_Right_Left),
+    USAGE(UP_Game_Controls, GC_Lean_Forward_Backward, Lean_Forward_Backward),
+    USAGE(UP_Game_Controls, GC_Height_of_POV, Height_of_POV),
+    USAGE(UP_Game_Controls, GC_Flipper, Flipper),
+    USAGE(UP_Game_Controls, GC_Secondary_Flipper, Secondary_Flipper),
+    USAGE(UP_Game_Controls, GC_Bump, Bump),
+    USAGE(UP_Game_Controls, GC_New_Game, New_Game),
+    USAGE(UP_Game_Controls, GC_Shoot_Ball, Shoot_Ball),
+    USAGE(UP_Game_Controls, GC_Player, Player),
+    USAGE(UP_Game_Controls, GC_Gun_Bolt, Gun_Bolt),
+    USAGE(UP_Game_Controls, GC_Gun_Clip, Gun_Clip),
+    USAGE(UP_Game_Controls, GC_Gun_Selector, Gun_Selector),
+    USAGE(UP_Game_Controls, GC_Gun_Single_Shot, Gun_Single_Shot),
+    USAGE(UP_Game_Controls, GC_Gun_Burst, Gun_Burst),
+    USAGE(UP_Game_Controls, GC_Gun_Automatic, Gun_Automatic),
+    USAGE(UP_Game_Controls, GC_Gun_Safety, Gun_Safety),
+    USAGE(UP_Game_Controls, GC_Gamepad_Fire_Jump, Gamepad_Fire_Jump),
+    USAGE(UP_Game_Controls, GC_Gamepad_Trigger, Gamepad_Trigger),
+    USAGE(UP_Generic_Device_Controls, GDC_Battery_Strength, Battery_Strength),
+    USAGE(UP_Generic_Device_Controls, GDC_Wireless_Channel, Wireless_Channel),
+    USAGE(UP_Generic_Device_Controls, GDC_Wireless_ID, Wireless_ID),
+    USAGE(UP_Generic_Device_Controls, GDC_Discover_Wireless_Ctrl, Discover_Wireless_Ctrl),
+    USAGE(UP_Generic_Device_Controls, GDC_SC_Character_Entered, Security_Code_Character_Entered),
+    USAGE(UP_Generic_Device_Controls, GDC_SC_Character_Cleared, Security_Code_Character_Cleared),
+    USAGE(UP_Generic_Device_Controls, GDC_SC_Cleared, Security_Code_Cleared),
+    USAGE(UP_LEDs, LED_Num_Lock, Num_Lock),
+    USAGE(UP_LEDs, LED_Caps_Lock, Caps_Lock),
+    USAGE(UP_LEDs, LED_Scroll_Lock, Scroll_Lock),
+    USAGE(UP_LEDs, LED_Compose, Compose),
+    USAGE(UP_LEDs, LED_Kana, Kana),
+    USAGE(UP_LEDs, LED_Power, Power),
+    USAGE(UP_LEDs, LED_Shift, Shift),
+    USAGE(UP_LEDs, LED_Donot_Disturb, Donot_Disturb),
+    USAGE(UP_LEDs, LED_Mute, Mute),
+    USAGE(UP_LEDs, LED_Tone_Enable, Tone_Enable),
+    USAGE(UP_LEDs, LED_High_Cut_Filter, High_Cut_Filter),
+    USAGE(UP_LEDs, LED_Low_Cut_Filter, Low_Cut_Filter),
+    USAGE(UP_LEDs, LED_Equalizer_Enable, Equalizer_Enable),
+    USAGE(UP_LEDs, LED_Sound_Field_On, Sound_Field_On),
+    USAGE(UP_LEDs, LED_Surround_On, Surround_On),
+    USAGE(UP_LEDs, LED_Repeat, Repeat),
+    USAGE(UP_LEDs, LED_Stereo, Stereo),
+    USAGE(UP_LEDs, LED_Sampling_Rate_Detect, Sampling_Rate_Detect),
+    USAGE(UP_LEDs, LED_Spinning, Spinning),
+    USAGE(UP_LEDs, LED_CAV, CAV),
+    USAGE(UP_LEDs, LED_CLV, CLV),
+    USAGE(UP_LEDs, LED_Recording_Format_Detect, Recording_Format_Detect),
+    USAGE(UP_LEDs, LED_Off_Hook, Off_Hook),
+    USAGE(UP_LEDs, LED_Ring, Ring),
+    USAGE(UP_LEDs, LED_Message_Waiting, Message_Waiting),
+    USAGE(UP_LEDs, LED_Data_Mode, Data_Mode),
+    USAGE(UP_LEDs, LED_Battery_Operation, Battery_Operation),
+    USAGE(UP_LEDs, LED_Battery_OK, Battery_OK),
+    USAGE(UP_LEDs, LED_Battery_Low, Battery_LOW),
+    USAGE(UP_LEDs, LED_Speaker, Speaker),
+    USAGE(UP_LEDs, LED_Head_Set, Head_Set),
+    USAGE(UP_LEDs, LED_Hold, Hold),
+    USAGE(UP_LEDs, LED_Microphone, Microphone),
+    USAGE(UP_LEDs, LED_Coverage, Coverage),
+    USAGE(UP_LEDs, LED_Night_Mode, Night_Mode),
+    USAGE(UP_LEDs, LED_Send_Calls, Send_Calls),
+    USAGE(UP_LEDs, LED_Call_Pickup, Call_Pickup),
+    USAGE(UP_LEDs, LED_Conference, Conference),
+    USAGE(UP_LEDs, LED_Standby, Standby),
+    USAGE(UP_LEDs, LED_Camera_On, Camera_On),
+    USAGE(UP_LEDs, LED_Camera_Off, Camera_Off),
+    USAGE(UP_LEDs, LED_On_Line, On_Line),
+    USAGE(UP_LEDs, LED_Off_Line, Off_Line),
+    USAGE(UP_LEDs, LED_Busy, Busy),
+    USAGE(UP_LEDs, LED_Ready, Ready),
+    USAGE(UP_LEDs, LED_Paper_Out, Paper_Out),
+    USAGE(UP_LEDs, LED_Paper_Jam, Paper_Jam),
+    USAGE(UP_LEDs, LED_Remote, Remote),
+    USAGE(UP_LEDs, LED_Forward, Forward),
+    USAGE(UP_LEDs, LED_Reverse, Reverse),
+    USAGE(UP_LEDs, LED_Stop, Stop),
+    USAGE(UP_LEDs, LED_Rewind, Rewind),
+    USAGE(UP_LEDs, LED_Fast_Forward, Fast_Forward),
+    USAGE(UP_LEDs, LED_Play, Play),
+    USAGE(UP_LEDs, LED_Pause, Pause),
+    USAGE(UP_LEDs, LED_Record, Record),
+    USAGE(UP_LEDs, LED_Error, Error),
+    USAGE(UP_LEDs, LED_Selected_Indicator, Selected_Indicator),
+    USAGE(UP_LEDs, LED_In_Use_Indicator, In_Use_Indicator),
+    USAGE(UP_LEDs, LED_Multi_Mode_Indicator, Multi_Mode_Indicator),
+    USAGE(UP_LEDs, LED_Indicator_On, Indicator_On),
+    USAGE(UP_LEDs, LED_Indicator_Flash, Indicator_Flash),
+    USAGE(UP_LEDs, LED_Indicator_Slow_Blink, Indicator_Slow_Blink),
+    USAGE(UP_LEDs, LED_Indicator_Fast_Blink, Indicator_Fast_Blink),
+    USAGE(UP_LEDs, LED_Indicator_Off, Indicator_Off),
+    USAGE(UP_LEDs, LED_Flash_On_Time, Flash_On_Time),
+    USAGE(UP_LEDs, LED_Slow_Blink_On_Time, Slow_Blink_On_Time),
+    USAGE(UP_LEDs, LED_Slow_Blink_Off_Time, Slow_Blink_Off_Time),
+    USAGE(UP_LEDs, LED_Fast_Blink_On_Time, Fast_Blink_On_Time),
+    USAGE(UP_LEDs, LED_Fast_Blink_Off_Time, Fast_Blink_Off_Time),
+    USAGE(UP_LEDs, LED_Usage_Indicator_Color, Usage_Indicator_Color),
+    USAGE(UP_LEDs, LED_Indicator_Red, Indicator_Red),
+    USAGE(UP_LEDs, LED_Indicator_Green, Indicator_Green),
+    USAGE(UP_LEDs, LED_Indicator_Amber, Indicator_Amber),
+    USAGE(UP_LEDs, LED_Generic_Indicator, Generic_Indicator),
+    USAGE(UP_LEDs, LED_Sys_Suspend, System_Suspend),
+    USAGE(UP_LEDs, LED_External_Power_Connected, External_Power_Connected),
+    USAGE(UP_Telephony, TD_Phone, Phone),
+    USAGE(UP_Telephony, TD_Answering_Machine, Answering_Machine),
+    USAGE(UP_Telephony, TD_Message_Controls, Message_Controls),
+    USAGE(UP_Telephony, TD_Handset, Handset),
+    USAGE(UP_Telephony, TD_Headset, Headset),
+    USAGE(UP_Telephony, TD_Telephony_Key_Pad, Telephony_Key_Pad),
+    USAGE(UP_Telephony, TD_Programmable_Button, Programmable_Button),
+    USAGE(UP_Telephony, TD_Hook_Switch, Hook_Switch),
+    USAGE(UP_Telephony, TD_Flash, Flash),
+    USAGE(UP_Telephony, TD_Feature, Feature),
+    USAGE(UP_Telephony, TD_Hold, Hold),
+    USAGE(UP_Telephony, TD_Redial, Redial),
+    USAGE(UP_Telephony, TD_Transfer, Transfer),
+    USAGE(UP_Telephony, TD_Drop, Drop),
+    USAGE(UP_Telephony, TD_Park, Park),
+    USAGE(UP_Telephony, TD_Forward_Calls, Forward_Calls),
+    USAGE(UP_Telephony, TD_Alternate_Function, Alternate_Function),
+    USAGE(UP_Telephony, TD_Line, Line),
+    USAGE(UP_Telephony, TD_Speaker_Phone, Speaker_Phone),
+    USAGE(UP_Telephony, TD_Conference, Conference),
+    USAGE(UP_Telephony, TD_Ring_Enable, Ring_Enable),
+    USAGE(UP_Telephony, TD_Ring_Select, Ring_Select),
+    USAGE(UP_Telephony, TD_Phone_Mute, Phone_Mute),
+    USAGE(UP_Telephony, TD_Caller_ID, Caller_ID),
+    USAGE(UP_Telephony, TD_Send, Send),
+    USAGE(UP_Telephony, TD_Speed_Dial, Speed_Dial),
+    USAGE(UP_Telephony, TD_Store_Number, Store_Number),
+    USAGE(UP_Telephony, TD_Recall_Number, Recall_Number),
+    USAGE(UP_Telephony, TD_Phone_Directory, Phone_Directory),
+    USAGE(UP_Telephony, TD_Voice_Mail, Voice_Mail),
+    USAGE(UP_Telephony, TD_Screen_Calls, Screen_Calls),
+    USAGE(UP_Telephony, TD_Do_Not_Disturb, Do_Not_Disturb),
+    USAGE(UP_Telephony, TD_Message, Message),
+    USAGE(UP_Telephony, TD_Answer_On_Off, Answer_On_Off),
+    USAGE(UP_Telephony, TD_Inside_Dial_Tone, Inside_Dial_Tone),
+    USAGE(UP_Telephony, TD_Outside_Dial_Tone, Outside_Dial_Tone),
+    USAGE(UP_Telephony, TD_Inside_Ring_Tone, Inside_Ring_Tone),
+    USAGE(UP_Telephony, TD_Outside_Ring_Tone, Outside_Ring_Tone),
+    USAGE(UP_Telephony, TD_Priority_Ring_Tone, Priority_Ring_Tone),
+    USAGE(UP_Telephony, TD_Inside_Ringback, Inside_Ringback),
+    USAGE(UP_Telephony, TD_Priority_Ringback, Priority_Ringback),
+    USAGE(UP_Telephony, TD_Line_Busy_Tone, Line_Busy_Tone),
+    USAGE(UP_Telephony, TD_Reorder_Tone, Reorder_Tone),
+    USAGE(UP_Telephony, TD_Call_Waiting_Tone, Call_Waiting_Tone),
+    USAGE(UP_Telephony, TD_Confirmation_Tone_1, Confirmation_Tone_1),
+    USAGE(UP_Telephony, TD_Confirmation_Tone_2, Confirmation_Tone_2),
+    USAGE(UP_Telephony, TD_Tones_Off, Tones_Off),
+    USAGE(UP_Telephony, TD_Outside_Ringback, Outside_Ringback),
+    USAGE(UP_Telephony, TD_Ringer, Ringer),
+    USAGE(UP_Consumer, UC_Consumer_Ctrl, Consumer_Control),
+    USAGE(UP_Consumer, UC_Numeric_Keypad, Numeric_Key_Pad),
+    USAGE(UP_Consumer, UC_Prog_Btns, Programmable_Buttons),
+    USAGE(UP_Consumer, UC_Mic, Microphone),
+    USAGE(UP_Consumer, UC_Headphone, Headphone),
+    USAGE(UP_Consumer, UC_Graphic_Equalizer, Graphic_Equalizer),
+    USAGE(UP_Consumer, UC_Add_10, N10),
+    USAGE(UP_Consumer, UC_Add_100, N100),
+    USAGE(UP_Consumer, UC_AM_PM, AM_PM),
+    USAGE(UP_Consumer, UC_Power, Power),
+    USAGE(UP_Consumer, UC_Reset, Reset),
+    USAGE(UP_Consumer, UC_Sleep, Sleep),
+    USAGE(UP_Consumer, UC_Sleep_After, Sleep_After),
+    USAGE(UP_Consumer, UC_Sleep_Mode, Sleep_Mode),
+    USAGE(UP_Consumer, UC_ILL, Illumination),
+    USAGE(UP_Consumer, UC_Function_Buttons, Function_Buttons),
+    USAGE(UP_Consumer, UC_Menu, Menu),
+    USAGE(UP_Consumer, UC_Menu_Pick, Menu_Pick),
+    USAGE(UP_Consumer, UC_Menu_Up, Menu_Up),
+    USAGE(UP_Consumer, UC_Menu_Down, Menu_Down),
+    USAGE(UP_Consumer, UC_Menu_Left, Menu_Left),
+    USAGE(UP_Consumer, UC_Menu_Right, Menu_Right),
+    USAGE(UP_Consumer, UC_Menu_Escape, Menu_Escape),
+    USAGE(UP_Consumer, UC_Menu_Value_Incr, Menu_Value_Increase),
+    USAGE(UP_Consumer, UC_Menu_Value_Decr, Menu_Value_Decrease),
+    USAGE(UP_Consumer, UC_Data_On_Screen, Data_On_Screen),
+    USAGE(UP_Consumer, UC_Closed_Caption, Closed_Caption),
+    USAGE(UP_Consumer, UC_Closed_Caption_Sel, Closed_Caption_Select),
+    USAGE(UP_Consumer, UC_VCR_TV, VCR_TV),
+    USAGE(UP_Consumer, UC_Broadcast_Mode, Broadcast_Mode),
+    USAGE(UP_Consumer, UC_Snapshot, Snapshot),
+    USAGE(UP_Consumer, UC_Still, Still),
+    USAGE(UP_Consumer, UC_Selion, Selection),
+    USAGE(UP_Consumer, UC_Assign_Selion, Assign_Selection),
+    USAGE(UP_Consumer, UC_Mode_Step, Mode_Step),
+    USAGE(UP_Consumer, UC_Recall_Last, Recall_Last),
+    USAGE(UP_Consumer, UC_Enter_Channel, Enter_Channel),
+    USAGE(UP_Consumer, UC_Order_Movie, Order_Movie),
+    USAGE(UP_Consumer, UC_Channel, Channel),
+    USAGE(UP_Consumer, UC_Media_Selion, Media_Selection),
+    USAGE(UP_Consumer, UC_Media_Sel_Computer, Media_Select_Computer),
+    USAGE(UP_Consumer, UC_Media_Sel_TV, Media_Select_TV),
+    USAGE(UP_Consumer, UC_Media_Sel_WWW, Media_Select_WWW),
+    USAGE(UP_Consumer, UC_Media_Sel_DVD, Media_Select_DVD),
+    USAGE(UP_Consumer, UC_Media_Sel_Telephone, Media_Select_Telephone),
+    USAGE(UP_Consumer, UC_Media_Sel_Program_Guide, Media_Select_Program_Guide),
+    USAGE(UP_Consumer, UC_Media_Sel_Video_Phone, Media_Select_Video_Phone),
+    USAGE(UP_Consumer, UC_Media_Sel_Games, Media_Select_Games),
+    USAGE(UP_Consumer, UC_Media_Sel_Messages, Media_Select_Messages),
+    USAGE(UP_Consumer, UC_Media_Sel_CD, Media_Select_CD),
+    USAGE(UP_Consumer, UC_Media_Sel_VCR, Media_Select_VCR),
+    USAGE(UP_Consumer, UC_Media_Sel_Tuner, Media_Select_Tuner),
+    USAGE(UP_Consumer, UC_Quit, Quit),
+    USAGE(UP_Consumer, UC_Help, Help),
+    USAGE(UP_Consumer, UC_Media_Sel_Tape, Media_Select_Tape),
+    USAGE(UP_Consumer, UC_Media_Sel_Cable, Media_Select_Cable),
+    USAGE(UP_Consumer, UC_Media_Sel_Satellite, Media_Select_Satellite),
+    USAGE(UP_Consumer, UC_Media_Sel_Security, Media_Select_Security),
+    USAGE(UP_Consumer, UC_Media_Sel_Home, Media_Select_Home),
+    USAGE(UP_Consumer, UC_Media_Sel_Call, Media_Select_Call),
+    USAGE(UP_Consumer, UC_Channel_Incr, Channel_Increment),
+    USAGE(UP_Consumer, UC_Channel_Decr, Channel_Decrement),
+    USAGE(UP_Consumer, UC_Media_Sel_SAP, Media_Select_SAP),
+    USAGE(UP_Consumer, UC_VCR_Plus, VCR_Plus),
+    USAGE(UP_Consumer, UC_Once, Once),
+    USAGE(UP_Consumer, UC_Daily, Daily),
+    USAGE(UP_Consumer, UC_Weekly, Weekly),
+    USAGE(UP_Consumer, UC_Monthly, Monthly),
+    USAGE(UP_Consumer, UC_Play, Play),
+    USAGE(UP_Consumer, UC_Pause, Pause),
+    USAGE(UP_Consumer, UC_Record, Record),
+    USAGE(UP_Consumer, UC_Fast_Forward, Fast_Forward),
+    USAGE(UP_Consumer, UC_Rewind, Rewind),
+    USAGE(UP_Consumer, UC_Scan_Next_Track, Scan_Next_Track),
+    USAGE(UP_Consumer, UC_Scan_Previous_Track, Scan_Previous_Track),
+    USAGE(UP_Consumer, UC_Stop, Stop),
+    USAGE(UP_Consumer, UC_Eject, Eject),
+    USAGE(UP_Consumer, UC_Random_Play, Random_Play),
+    USAGE(UP_Consumer, UC_Sel_Disc, Select_Disc),
+    USAGE(UP_Consumer, UC_Enter_Disc, Enter_Disc),
+    USAGE(UP_Consumer, UC_Repeat, Repeat),
+    USAGE(UP_Consumer, UC_Tracking, Tracking),
+    USAGE(UP_Consumer, UC_Track_Normal, Track_Normal),
+    USAGE(UP_Consumer, UC_Slow_Tracking, Slow_Tracking),
+    USAGE(UP_Consumer, UC_Frame_Forward, Frame_Forward),
+    USAGE(UP_Consumer, UC_Frame_Back, Frame_Back),
+    USAGE(UP_Consumer, UC_Mark, Mark),
+    USAGE(UP_Consumer, UC_Clear_Mark, Clear_Mark),
+    USAGE(UP_Consumer, UC_Repeat_From_Mark, Repeat_From_Mark),
+    USAGE(UP_Consumer, UC_Return_To_Mark, Return_To_Mark),
+    USAGE(UP_Consumer, UC_Search_Mark_Forward, Search_Mark_Forward),
+    USAGE(UP_Consumer, UC_Search_Mark_Backward, Search_Mark_Backwards),
+    USAGE(UP_Consumer, UC_Counter_Reset, Counter_Reset),
+    USAGE(UP_Consumer, UC_Show_Counter, Show_Counter),
+    USAGE(UP_Consumer, UC_Tracking_Incr, Tracking_Increment),
+    USAGE(UP_Consumer, UC_Tracking_Decr, Tracking_Decrement),
+    USAGE(UP_Consumer, UC_Stop_Eject, Stop_Eject),
+    USAGE(UP_Consumer, UC_Play_Pause, Play_Pause),
+    USAGE(UP_Consumer, UC_Play_Skip, Play_Skip),
+    USAGE(UP_Consumer, UC_Volume, Volume),
+    USAGE(UP_Consumer, UC_Balance, Balance),
+    USAGE(UP_Consumer, UC_Mute, Mute),
+    USAGE(UP_Consumer, UC_Bass, Bass),
+    USAGE(UP_Consumer, UC_Treble, Treble),
+    USAGE(UP_Consumer, UC_Bass_Boost, Bass_Boost),
+    USAGE(UP_Consumer, UC_Surround_Mode, Surround_Mode),
+    USAGE(UP_Consumer, UC_Loudness, Loudness),
+    USAGE(UP_Consumer, UC_MPX, MPX),
+    USAGE(UP_Consumer, UC_Volume_Incr, Volume_Increment),
+    USAGE(UP_Consumer, UC_Volume_Decr, Volume_Decrement),
+    USAGE(UP_Consumer, UC_Speed_Sel, Speed_Select),
+    USAGE(UP_Consumer, UC_Playback_Speed, Playback_Speed),
+    USAGE(UP_Consumer, UC_Standard_Play, Standard_Play),
+    USAGE(UP_Consumer, UC_Long_Play, Long_Play),
+    USAGE(UP_Consumer, UC_Extended_Play, Extended_Play),
+    USAGE(UP_Consumer, UC_Slow, Slow),
+    USAGE(UP_Consumer, UC_Fan_Enable, Fan_Enable),
+    USAGE(UP_Consumer, UC_Fan_Speed, Fan_Speed),
+    USAGE(UP_Consumer, UC_Light_Enable, Light_Enable),
+    USAGE(UP_Consumer, UC_Light_ILL_Level, Light_Illumination_Level),
+    USAGE(UP_Consumer, UC_Climate_Ctrl_Enable, Climate_Control_Enable),
+    USAGE(UP_Consumer, UC_Room_Temperature, Room_Temperature),
+    USAGE(UP_Consumer, UC_Security_Enable, Security_Enable),
+    USAGE(UP_Consumer, UC_Fire_Alarm, Fire_Alarm),
+    USAGE(UP_Consumer, UC_Police_Alarm, Police_Alarm),
+    USAGE(UP_Consumer, UC_Proximity, Proximity),
+    USAGE(UP_Consumer, UC_Motion, Motion),
+    USAGE(UP_Consumer, UC_Duress_Alarm, Duress_Alarm),
+    USAGE(UP_Consumer, UC_Holdup_Alarm, Holdup_Alarm),
+    USAGE(UP_Consumer, UC_Medical_Alarm, Medical_Alarm),
+    USAGE(UP_Consumer, UC_Balance_Right, Balance_Right),
+    USAGE(UP_Consumer, UC_Balance_Left, Balance_Left),
+    USAGE(UP_Consumer, UC_Bass_Incr, Bass_Increment),
+    USAGE(UP_Consumer, UC_Bass_Decr, Bass_Decrement),
+    USAGE(UP_Consumer, UC_Treble_Incr, Treble_Increment),
+    USAGE(UP_Consumer, UC_Treble_Decr, Treble_Decrement),
+    USAGE(UP_Consumer, UC_Speaker_Sys, Speaker_System),
+    USAGE(UP_Consumer, UC_Channel_Left, Channel_Left),
+    USAGE(UP_Consumer, UC_Channel_Right, Channel_Right),
+    USAGE(UP_Consumer, UC_Channel_Center, Channel_Center),
+    USAGE(UP_Consumer, UC_Channel_Front, Channel_Front),
+    USAGE(UP_Consumer, UC_Channel_Center_Front, Channel_Center_Front),
+    USAGE(UP_Consumer, UC_Channel_Side, Channel_Side),
+    USAGE(UP_Consumer, UC_Channel_Surround, Channel_Surround),
+    USAGE(UP_Consumer, UC_Channel_Low_Frequency_Enhancement, Channel_Low_Frequency_Enhancement),
+    USAGE(UP_Consumer, UC_Channel_Top, Channel_Top),
+    USAGE(UP_Consumer, UC_Channel_Unknown, Channel_Unknown),
+    USAGE(UP_Consumer, UC_Subchannel, Sub_channel),
+    USAGE(UP_Consumer, UC_Subchannel_Incr, Sub_channel_Increment),
+    USAGE(UP_Consumer, UC_Subchannel_Decr, Sub_channel_Decrement),
+    USAGE(UP_Consumer, UC_Alternate_Audio_Incr, Alternate_Audio_Increment),
+    USAGE(UP_Consumer, UC_Alternate_Audio_Decr, Alternate_Audio_Decrement),
+    USAGE(UP_Consumer, UC_App_Launch_Btns, Application_Launch_Buttons),
+    USAGE(UP_Consumer, UC_AL_Launch_Btn_Config_Tool, AL_Launch_Button_Configuration_Tool),
+    USAGE(UP_Consumer, UC_AL_Prog_Btn_Config, AL_Programmable_Button_Configuration),
+    USAGE(UP_Consumer, UC_AL_Consumer_Ctrl_Config, AL_Consumer_Control_Configuration),
+    USAGE(UP_Consumer, UC_AL_Word_Processor, AL_Word_Processor),
+    USAGE(UP_Consumer, UC_AL_Text_Editor, AL_Text_Editor),
+    USAGE(UP_Consumer, UC_AL_Spreadsheet, AL_Spreadsheet),
+    USAGE(UP_Consumer, UC_AL_Graphics_Editor, AL_Graphics_Editor),
+    USAGE(UP_Consumer, UC_AL_Presentation_App, AL_Presentation_App),
+    USAGE(UP_Consumer, UC_AL_Database_App, AL_Database_App),
+    USAGE(UP_Consumer, UC_AL_Email_Reader, AL_Email_Reader),
+    USAGE(UP_Consumer, UC_AL_Newsreader, AL_Newsreader),
+    USAGE(UP_Consumer, UC_AL_Voicemail, AL_Voicemail),
+    USAGE(UP_Consumer, UC_AL_Contacts_Address_Book, AL_Contacts_Address_Book),
+    USAGE(UP_Consumer, UC_AL_Calendar_Schedule, AL_Calendar_Schedule),
+    USAGE(UP_Consumer, UC_AL_Task_Project_Manager, AL_Task_Project_Manager),
+    USAGE(UP_Consumer, UC_AL_Log_Journal_Timecard, AL_Log_Journal_Timecard),
+    USAGE(UP_Consumer, UC_AL_Checkbook_Finance, AL_Checkbook_Finance),
+    USAGE(UP_Consumer, UC_AL_Calculator, AL_Calculator),
+    USAGE(UP_Consumer, UC_AL_AV_Capture_Playback, AL_A_V_Capture_Playback),
+    USAGE(UP_Consumer, UC_AL_Local_Machine_Browser, AL_Local_Machine_Browser),
+    USAGE(UP_Consumer, UC_AL_LAN_WAN_Browser, AL_LAN_WAN_Browser),
+    USAGE(UP_Consumer, UC_AL_Internet_Browser, AL_Internet_Browser),
+    USAGE(UP_Consumer, UC_AL_RemoteNet_ISP_Connect, AL_Remote_Networking_ISP_Connect),
+    USAGE(UP_Consumer, UC_AL_Net_Conference, AL_Network_Conference),
+    USAGE(UP_Consumer, UC_AL_Net_Chat, AL_Network_Chat),
+    USAGE(UP_Consumer, UC_AL_Telephony_Dialer, AL_Telephony_Dialer),
+    USAGE(UP_Consumer, UC_AL_Logon, AL_Logon),
+    USAGE(UP_Consumer, UC_AL_Logoff, AL_Logoff),
+    USAGE(UP_Consumer, UC_AL_Logon_Logoff, AL_Logon_Logoff),
+    USAGE(UP_Consumer, UC_AL_Terminal_Lock_Screensaver, AL_Terminal_Lock_Screensaver),
+    USAGE(UP_Consumer, UC_AL_Ctrl_Panel, AL_Control_Panel),
+    USAGE(UP_Consumer, UC_AL_Command_Line_Processor_Run, AL_Command_Line_Processor_Run),
+    USAGE(UP_Consumer, UC_AL_Process_Task_Manager, AL_Process_Task_Manager),
+    USAGE(UP_Consumer, UC_AL_Sel_Task_App, AL_Select_Task_Application),
+    USAGE(UP_Consumer, UC_AL_Next_Task_App, AL_Next_Task_Application),
+    USAGE(UP_Consumer, UC_AL_Previous_Task_App, AL_Previous_Task_Application),
+    USAGE(UP_Consumer, UC_AL_Preemptive_Halt_Task_App, AL_Preemptive_Halt_Task_Application),
+    USAGE(UP_Consumer, UC_AL_Integrated_Help_Center, AL_Integrated_Help_Center),
+    USAGE(UP_Consumer, UC_AL_Documents, AL_Documents),
+    USAGE(UP_Consumer, UC_AL_Thesaurus, AL_Thesaurus),
+    USAGE(UP_Consumer, UC_AL_Dictionary, AL_Dictionary),
+    USAGE(UP_Consumer, UC_AL_Desktop, AL_Desktop),
+    USAGE(UP_Consumer, UC_AL_Spell_Check, AL_Spell_Check),
+    USAGE(UP_Consumer, UC_AL_Grammar_Check, AL_Grammar_Check),
+    USAGE(UP_Consumer, UC_AL_Wireless_Status, AL_Wireless_Status),
+    USAGE(UP_Consumer, UC_AL_Keyboard_Layout, AL_Keyboard_Layout),
+    USAGE(UP_Consumer, UC_AL_Virus_Protection, AL_Virus_Protection),
+    USAGE(UP_Consumer, UC_AL_Encryption, AL_Encryption),
+    USAGE(UP_Consumer, UC_AL_Screen_Saver, AL_Screen_Saver),
+    USAGE(UP_Consumer, UC_AL_Alarms, AL_Alarms),
+    USAGE(UP_Consumer, UC_AL_Clock, AL_Clock),
+    USAGE(UP_Consumer, UC_AL_File_Browser, AL_File_Browser),
+    USAGE(UP_Consumer, UC_AL_Power_Status, AL_Power_Status),
+    USAGE(UP_Consumer, UC_AL_Image_Browser, AL_Image_Browser),
+    USAGE(UP_Consumer, UC_AL_Audio_Browser, AL_Audio_Browser),
+    USAGE(UP_Consumer, UC_AL_Movie_Browser, AL_Movie_Browser),
+    USAGE(UP_Consumer, UC_AL_Digital_Rights_Manager, AL_Digital_Rights_Manager),
+    USAGE(UP_Consumer, UC_AL_Digital_Wallet, AL_Digital_Wallet),
+    USAGE(UP_Consumer, UC_AL_Instant_Messaging, AL_Instant_Messaging),
+    USAGE(UP_Consumer, UC_AL_OEM_Features_Tips_Tutorial_Browser, AL_OEM_Features_Tips_Tutorial_Browser),
+    USAGE(UP_Consumer, UC_AL_OEM_Help, AL_OEM_Help),
+    USAGE(UP_Consumer, UC_AL_Online_Community, AL_Online_Community),
+    USAGE(UP_Consumer, UC_AL_Entertainment_Content_Browser, AL_Entertainment_Content_Browser),
+    USAGE(UP_Consumer, UC_AL_Online_Shopping_Browser, AL_Online_Shopping_Browser),
+    USAGE(UP_Consumer, UC_AL_SmartCard_Information_Help, AL_SmartCard_Information_Help),
+    USAGE(UP_Consumer, UC_AL_Market_Monitoror_Finance_Browser, AL_Market_Monitor_Finance_Browser),
+    USAGE(UP_Consumer, UC_AL_Customized_Corporate_News_Browser, AL_Customized_Corporate_News_Browser),
+    USAGE(UP_Consumer, UC_AL_Online_Activity_Browser, AL_Online_Activity_Browser),
+    USAGE(UP_Consumer, UC_AL_Research_Search_Browser, AL_Research_Search_Browser),
+    USAGE(UP_Consumer, UC_AL_Audio_Player, AL_Audio_Player),
+    USAGE(UP_Consumer, UC_Generic_GUI_App_Ctrls, Generic_GUI_Application_Controls),
+    USAGE(UP_Consumer, UC_AC_New, AC_New),
+    USAGE(UP_Consumer, UC_AC_Open, AC_Open),
+    USAGE(UP_Consumer, UC_AC_Close, AC_Close),
+    USAGE(UP_Consumer, UC_AC_Exit, AC_Exit),
+    USAGE(UP_Consumer, UC_AC_Maximize, AC_Maximize),
+    USAGE(UP_Consumer, UC_AC_Minimize, AC_Minimize),
+    USAGE(UP_Consumer, UC_AC_Save, AC_Save),
+    USAGE(UP_Consumer, UC_AC_Print, AC_Print),
+    USAGE(UP_Consumer, UC_AC_Properties, AC_Properties),
+    USAGE(UP_Consumer, UC_AC_Undo, AC_Undo),
+    USAGE(UP_Consumer, UC_AC_Copy, AC_Copy),
+    USAGE(UP_Consumer, UC_AC_Cut, AC_Cut),
+    USAGE(UP_Consumer, UC_AC_Paste, AC_Paste),
+    USAGE(UP_Consumer, UC_AC_Sel_All, AC_Select_All),
+    USAGE(UP_Consumer, UC_AC_Find, AC_Find),
+    USAGE(UP_Consumer, UC_AC_Find_and_Replace, AC_Find_and_Replace),
+    USAGE(UP_Consumer, UC_AC_Search, AC_Search),
+    USAGE(UP_Consumer, UC_AC_Go_To, AC_Go_To),
+    USAGE(UP_Consumer, UC_AC_Home, AC_Home),
+    USAGE(UP_Consumer, UC_AC_Back, AC_Back),
+    USAGE(UP_Consumer, UC_AC_Forward, AC_Forward),
+    USAGE(UP_Consumer, UC_AC_Stop, AC_Stop),
+    USAGE(UP_Consumer, UC_AC_Refresh, AC_Refresh),
+    USAGE(UP_Consumer, UC_AC_Previous_Link, AC_Previous_Link),
+    USAGE(UP_Consumer, UC_AC_Next_Link, AC_Next_Link),
+    USAGE(UP_Consumer, UC_AC_Bookmarks, AC_Bookmarks),
+    USAGE(UP_Consumer, UC_AC_History, AC_History),
+    USAGE(UP_Consumer, UC_AC_Subscriptions, AC_Subscriptions),
+    USAGE(UP_Consumer, UC_AC_Zoom_In, AC_Zoom_In),
+    USAGE(UP_Consumer, UC_AC_Zoom_Out, AC_Zoom_Out),
+    USAGE(UP_Consumer, UC_AC_Zoom, AC_Zoom),
+    USAGE(UP_Consumer, UC_AC_Full_Screen_View, AC_Full_Screen_View),
+    USAGE(UP_Consumer, UC_AC_Normal_View, AC_Normal_View),
+    USAGE(UP_Consumer, UC_AC_View_Toggle, AC_View_Toggle),
+    USAGE(UP_Consumer, UC_AC_Scroll_Up, AC_Scroll_Up),
+    USAGE(UP_Consumer, UC_AC_Scroll_Down, AC_Scroll_Down),
+    USAGE(UP_Consumer, UC_AC_Scroll, AC_Scroll),
+    USAGE(UP_Consumer, UC_AC_Pan_Left, AC_Pan_Left),
+    USAGE(UP_Consumer, UC_AC_Pan_Right, AC_Pan_Right),
+    USAGE(UP_Consumer, UC_AC_Pan, AC_Pan),
+    USAGE(UP_Consumer, UC_AC_New_Window, AC_New_Window),
+    USAGE(UP_Consumer, UC_AC_Tile_Horizontally, AC_Tile_Horizontally),
+    USAGE(UP_Consumer, UC_AC_Tile_Vertically, AC_Tile_Vertically),
+    USAGE(UP_Consumer, UC_AC_Format, AC_Format),
+    USAGE(UP_Consumer, UC_AC_Edit, AC_Edit),
+    USAGE(UP_Consumer, UC_AC_Bold, AC_Bold),
+    USAGE(UP_Consumer, UC_AC_Italics, AC_Italics),
+    USAGE(UP_Consumer, UC_AC_Underline, AC_Underline),
+    USAGE(UP_Consumer, UC_AC_Strikethrough, AC_Strikethrough),
+    USAGE(UP_Consumer, UC_AC_Subscript, AC_Subscript),
+    USAGE(UP_Consumer, UC_AC_Superscript, AC_Superscript),
+    USAGE(UP_Consumer, UC_AC_All_Caps, AC_All_Caps),
+    USAGE(UP_Consumer, UC_AC_Rotate, AC_Rotate),
+    USAGE(UP_Consumer, UC_AC_Resize, AC_Resize),
+    USAGE(UP_Consumer, UC_AC_Flip_Horiz, AC_Flip_horizontal),
+    USAGE(UP_Consumer, UC_AC_Flip_Verti, AC_Flip_Vertical),
+    USAGE(UP_Consumer, UC_AC_Mirror_Horizontal, AC_Mirror_Horizontal),
+    USAGE(UP_Consumer, UC_AC_Mirror_Vertical, AC_Mirror_Vertical),
+    USAGE(UP_Consumer, UC_AC_Font_Sel, AC_Font_Select),
+    USAGE(UP_Consumer, UC_AC_Font_Color, AC_Font_Color),
+    USAGE(UP_Consumer, UC_AC_Font_Size, AC_Font_Size),
+    USAGE(UP_Consumer, UC_AC_Justify_Left, AC_Justify_Left),
+    USAGE(UP_Consumer, UC_AC_Justify_Center_H, AC_Justify_Center_H),
+    USAGE(UP_Consumer, UC_AC_Justify_Right, AC_Justify_Right),
+    USAGE(UP_Consumer, UC_AC_Justify_Block_H, AC_Justify_Block_H),
+    USAGE(UP_Consumer, UC_AC_Justify_Top, AC_Justify_Top),
+    USAGE(UP_Consumer, UC_AC_Justify_Center_V, AC_Justify_Center_V),
+    USAGE(UP_Consumer, UC_AC_Justify_Bottom, AC_Justify_Bottom),
+    USAGE(UP_Consumer, UC_AC_Justify_Block_V, AC_Justify_Block_V),
+    USAGE(UP_Consumer, UC_AC_Indent_Decr, AC_Indent_Decrease),
+    USAGE(UP_Consumer, UC_AC_Indent_Incr, AC_Indent_Increase),
+    USAGE(UP_Consumer, UC_AC_Numbered_List, AC_Numbered_List),
+    USAGE(UP_Consumer, UC_AC_Restart_Numbering, AC_Restart_Numbering),
+    USAGE(UP_Consumer, UC_AC_Bulleted_List, AC_Bulleted_List),
+    USAGE(UP_Consumer, UC_AC_Promote, AC_Promote),
+    USAGE(UP_Consumer, UC_AC_Demote, AC_Demote),
+    USAGE(UP_Consumer, UC_AC_Yes, AC_Yes),
+    USAGE(UP_Consumer, UC_AC_No, AC_No),
+    USAGE(UP_Consumer, UC_AC_Cancel, AC_Cancel),
+    USAGE(UP_Consumer, UC_AC_Catalog, AC_Catalog),
+    USAGE(UP_Consumer, UC_AC_BuyorCheckout, AC_Buy_Checkout),
+    USAGE(UP_Consumer, UC_AC_Add_to_Cart, AC_Add_to_Cart),
+    USAGE(UP_Consumer, UC_AC_Expand, AC_Expand),
+    USAGE(UP_Consumer, UC_AC_Expand_All, AC_Expand_All),
+    USAGE(UP_Consumer, UC_AC_Collapse, AC_Collapse),
+    USAGE(UP_Consumer, UC_AC_Collapse_All, AC_Collapse_All),
+    USAGE(UP_Consumer, UC_AC_Print_Preview, AC_Print_Preview),
+    USAGE(UP_Consumer, UC_AC_Paste_Special, AC_Paste_Special),
+    USAGE(UP_Consumer, UC_AC_Insert_Mode, AC_Insert_Mode),
+    USAGE(UP_Consumer, UC_AC_Delete, AC_Delete),
+    USAGE(UP_Consumer, UC_AC_Lock, AC_Lock),
+    USAGE(UP_Consumer, UC_AC_Unlock, AC_Unlock),
+    USAGE(UP_Consumer, UC_AC_Protect, AC_Protect),
+    USAGE(UP_Consumer, UC_AC_Unprotect, AC_Unprotect),
+    USAGE(UP_Consumer, UC_AC_Attach_Comment, AC_Attach_Comment),
+    USAGE(UP_Consumer, UC_AC_Delete_Comment, AC_Delete_Comment),
+    USAGE(UP_Consumer, UC_AC_View_Comment, AC_View_Comment),
+    USAGE(UP_Consumer, UC_AC_Sel_Word, AC_Select_Word),
+    USAGE(UP_Consumer, UC_AC_Sel_Sentence, AC_Select_Sentence),
+    USAGE(UP_Consumer, UC_AC_Sel_Paragraph, AC_Select_Paragraph),
+    USAGE(UP_Consumer, UC_AC_Sel_Column, AC_Select_Column),
+    USAGE(UP_Consumer, UC_AC_Sel_Row, AC_Select_Row),
+    USAGE(UP_Consumer, UC_AC_Sel_Table, AC_Select_Table),
+    USAGE(UP_Consumer, UC_AC_Sel_Object, AC_Select_Object),
+    USAGE(UP_Consumer, UC_AC_Redo_Repeat, AC_Redo_Repeat),
+    USAGE(UP_Consumer, UC_AC_Sort, AC_Sort),
+    USAGE(UP_Consumer, UC_AC_Sort_Ascending, AC_Sort_Ascending),
+    USAGE(UP_Consumer, UC_AC_Sort_Descending, AC_Sort_Descending),
+    USAGE(UP_Consumer, UC_AC_Filter, AC_Filter),
+    USAGE(UP_Consumer, UC_AC_Set_Clock, AC_Set_Clock),
+    USAGE(UP_Consumer, UC_AC_View_Clock, AC_View_Clock),
+    USAGE(UP_Consumer, UC_AC_Sel_Time_Zone, AC_Select_Time_Zone),
+    USAGE(UP_Consumer, UC_AC_Edit_Time_Zones, AC_Edit_Time_Zones),
+    USAGE(UP_Consumer, UC_AC_Set_Alarm, AC_Set_Alarm),
+    USAGE(UP_Consumer, UC_AC_Clear_Alarm, AC_Clear_Alarm),
+    USAGE(UP_Consumer, UC_AC_Snooze_Alarm, AC_Snooze_Alarm),
+    USAGE(UP_Consumer, UC_AC_Reset_Alarm, AC_Reset_Alarm),
+    USAGE(UP_Consumer, UC_AC_Synchronize, AC_Synchronize),
+    USAGE(UP_Consumer, UC_AC_Send_or_Recv, AC_Send_Receive),
+    USAGE(UP_Consumer, UC_AC_Send_To, AC_Send_To),
+    USAGE(UP_Consumer, UC_AC_Reply, AC_Reply),
+    USAGE(UP_Consumer, UC_AC_Reply_All, AC_Reply_All),
+    USAGE(UP_Consumer, UC_AC_Forward_Msg, AC_Forward_Msg),
+    USAGE(UP_Consumer, UC_AC_Send, AC_Send),
+    USAGE(UP_Consumer, UC_AC_Attach_File, AC_Attach_File),
+    USAGE(UP_Consumer, UC_AC_Upload, AC_Upload),
+    USAGE(UP_Consumer, UC_AC_Download_Save_As, AC_Download_Save_Target_As),
+    USAGE(UP_Consumer, UC_AC_Set_Borders, AC_Set_Borders),
+    USAGE(UP_Consumer, UC_AC_Insert_Row, AC_Insert_Row),
+    USAGE(UP_Consumer, UC_AC_Insert_Column, AC_Insert_Column),
+    USAGE(UP_Consumer, UC_AC_Insert_File, AC_Insert_File),
+    USAGE(UP_Consumer, UC_AC_Insert_Picture, AC_Insert_Picture),
+    USAGE(UP_Consumer, UC_AC_Insert_Object, AC_Insert_Object),
+    USAGE(UP_Consumer, UC_AC_Insert_Symbol, AC_Insert_Symbol),
+    USAGE(UP_Consumer, UC_AC_Save_and_Close, AC_Save_and_Close),
+    USAGE(UP_Consumer, UC_AC_Rename, AC_Rename),
+    USAGE(UP_Consumer, UC_AC_Merge, AC_Merge),
+    USAGE(UP_Consumer, UC_AC_Split, AC_Split),
+    USAGE(UP_Consumer, UC_AC_Distribute_Horiz, AC_Distribute_Horizontally),
+    USAGE(UP_Consumer, UC_AC_Distribute_Verti, AC_Distribute_Vertically),
+    USAGE(UP_Digitizer, D_Digitizer, Digitizer),
+    USAGE(UP_Digitizer, D_Pen, Pen),
+    USAGE(UP_Digitizer, D_Light_Pen, Light_Pen),
+    USAGE(UP_Digitizer, D_Touch_Screen, Touch_Screen),
+    USAGE(UP_Digitizer, D_Touch_Pad, Touch_Pad),
+    USAGE(UP_Digitizer, D_White_Board, White_Board),
+    USAGE(UP_Digitizer, D_Coordinate_Measuring_Machine, Coordinate_Measuring_Machine),
+    USAGE(UP_Digitizer, D_4D_Digitizer, N3D_Digitizer),
+    USAGE(UP_Digitizer, D_Stereo_Plotter, Stereo_Plotter),
+    USAGE(UP_Digitizer, D_Articulated_Arm, Articulated_Arm),
+    USAGE(UP_Digitizer, D_Armature, Armature),
+    USAGE(UP_Digitizer, D_Multiple_Point_Digitizer, Multiple_Point_Digitizer),
+    USAGE(UP_Digitizer, D_Free_Space_Wand, Free_Space_Wand),
+    USAGE(UP_Digitizer, D_Stylus, Stylus),
+    USAGE(UP_Digitizer, D_Puck, Puck),
+    USAGE(UP_Digitizer, D_Finger, Finger),
+    USAGE(UP_Digitizer, D_Tip_Pressure, Tip_Pressure),
+    USAGE(UP_Digitizer, D_Barrel_Pressure, Barrel_Pressure),
+    USAGE(UP_Digitizer, D_In_Range, In_Range),
+    USAGE(UP_Digitizer, D_Touch, Touch),
+    USAGE(UP_Digitizer, D_Untouch, Untouch),
+    USAGE(UP_Digitizer, D_Tap, Tap),
+    USAGE(UP_Digitizer, D_Quality, Quality),
+    USAGE(UP_Digitizer, D_Data_Valid, Data_Valid),
+    USAGE(UP_Digitizer, D_Transducer_Index, Transducer_Index),
+    USAGE(UP_Digitizer, D_Tablet_Function_Keys, Tablet_Function_Keys),
+    USAGE(UP_Digitizer, D_Program_Change_Keys, Program_Change_Keys),
+    USAGE(UP_Digitizer, D_Battery_Strength, Battery_Strength),
+    USAGE(UP_Digitizer, D_Invert, Invert),
+    USAGE(UP_Digitizer, D_X_Tilt, X_Tilt),
+    USAGE(UP_Digitizer, D_Y_Tilt, Y_Tilt),
+    USAGE(UP_Digitizer, D_Azimuth, Azimuth),
+    USAGE(UP_Digitizer, D_Altitude, Altitude),
+    USAGE(UP_Digitizer, D_Twist, Twist),
+    USAGE(UP_Digitizer, D_Tip_Switch, Tip_Switch),
+    USAGE(UP_Digitizer, D_Secondary_Tip_Switch, Secondary_Tip_Switch),
+    USAGE(UP_Digitizer, D_Barrel_Switch, Barrel_Switch),
+    USAGE(UP_Digitizer, D_Eraser, Eraser),
+    USAGE(UP_Digitizer, D_Tablet_Pick, Tablet_Pick),
+    USAGE(UP_Alphanumeric_Display, AD_Alphanumeric_Display, Alphanumeric_Display),
+    USAGE(UP_Alphanumeric_Display, AD_Bitmapped_Display, Bitmapped_Display),
+    USAGE(UP_Alphanumeric_Display, AD_Display_Attributes_Report, Display_Attributes_Report),
+    USAGE(UP_Alphanumeric_Display, AD_ASCII_Character_Set, ASCII_Character_Set),
+    USAGE(UP_Alphanumeric_Display, AD_Data_Read_Back, Data_Read_Back),
+    USAGE(UP_Alphanumeric_Display, AD_Font_Read_Back, Font_Read_Back),
+    USAGE(UP_Alphanumeric_Display, AD_Display_Control_Report, Display_Control_Report),
+    USAGE(UP_Alphanumeric_Display, AD_Clear_Display, Clear_Display),
+    USAGE(UP_Alphanumeric_Display, AD_Display_Enable, Display_Enable),
+    USAGE(UP_Alphanumeric_Display, AD_Screen_Saver_Delay, Screen_Saver_Delay),
+    USAGE(UP_Alphanumeric_Display, AD_Screen_Saver_Enable, Screen_Saver_Enable),
+    USAGE(UP_Alphanumeric_Display, AD_Vertical_Scroll, Vertical_Scroll),
+    USAGE(UP_Alphanumeric_Display, AD_Horizontal_Scroll, Horizontal_Scroll),
+    USAGE(UP_Alphanumeric_Display, AD_Character_Report, Character_Report),
+    USAGE(UP_Alphanumeric_Display, AD_Display_Data, Display_Data),
+    USAGE(UP_Alphanumeric_Display, AD_Display_Status, Display_Status),
+    USAGE(UP_Alphanumeric_Display, AD_Stat_Not_Ready, Stat_Not_Ready),
+    USAGE(UP_Alphanumeric_Display, AD_Stat_Ready, Stat_Ready),
+    USAGE(UP_Alphanumeric_Display, AD_Err_Not_a_loadable_character, Err_Not_a_loadable_character),
+    USAGE(UP_Alphanumeric_Display, AD_Err_Font_data_cannot_be_read, Err_Font_data_cannot_be_read),
+    USAGE(UP_Alphanumeric_Display, AD_Cursor_Position_Report, Cursor_Position_Report),
+    USAGE(UP_Alphanumeric_Display, AD_Row, Row),
+    USAGE(UP_Alphanumeric_Display, AD_Column, Column),
+    USAGE(UP_Alphanumeric_Display, AD_Rows, Rows),
+    USAGE(UP_Alphanumeric_Display, AD_Columns, Columns),
+    USAGE(UP_Alphanumeric_Display, AD_Cursor_Pixel_Positioning, Cursor_Pixel_Positioning),
+    USAGE(UP_Alphanumeric_Display, AD_Cursor_Mode, Cursor_Mode),
+    USAGE(UP_Alphanumeric_Display, AD_Cursor_Enable, Cursor_Enable),
+    USAGE(UP_Alphanumeric_Display, AD_Cursor_Blink, Cursor_Blink),
+    USAGE(UP_Alphanumeric_Display, AD_Font_Report, Font_Report),
+    USAGE(UP_Alphanumeric_Display, AD_Font_Data, Font_Data),
+    USAGE(UP_Alphanumeric_Display, AD_Character_Width, Character_Width),
+    USAGE(UP_Alphanumeric_Display, AD_Character_Height, Character_Height),
+    USAGE(UP_Alphanumeric_Display, AD_Character_Spacing_Horizontal, Character_Spacing_Horizontal),
+    USAGE(UP_Alphanumeric_Display, AD_Character_Spacing_Vertical, Character_Spacing_Vertical),
+    USAGE(UP_Alphanumeric_Display, AD_Unicode_Character_Set, Unicode_Character_Set),
+    USAGE(UP_Alphanumeric_Display, AD_Font_7_Segment, Font_7_Segment),
+    USAGE(UP_Alphanumeric_Display, AD_7_Segment_Direct_Map, N7_Segment_Direct_Map),
+    USAGE(UP_Alphanumeric_Display, AD_Font_14_Segment, Font_14_Segment),
+    USAGE(UP_Alphanumeric_Display, AD_14_Segment_Direct_Map, N14_Segment_Direct_Map),
+    USAGE(UP_Alphanumeric_Display, AD_Display_Brightness, Display_Brightness),
+    USAGE(UP_Alphanumeric_Display, AD_Display_Contrast, Display_Contrast),
+    USAGE(UP_Alphanumeric_Display, AD_Character_Attribute, Character_Attribute),
+    USAGE(UP_Alphanumeric_Display, AD_Attribute_Readback, Attribute_Readback),
+    USAGE(UP_Alphanumeric_Display, AD_Attribute_Data, Attribute_Data),
+    USAGE(UP_Alphanumeric_Display, AD_Char_Attr_Enhance, Char_Attr_Enhance),
+    USAGE(UP_Alphanumeric_Display, AD_Char_Attr_Underline, Char_Attr_Underline),
+    USAGE(UP_Alphanumeric_Display, AD_Char_Attr_Blink, Char_Attr_Blink),
+    USAGE(UP_Alphanumeric_Display, AD_Bitmap_Size_X, Bitmap_Size_X),
+    USAGE(UP_Alphanumeric_Display, AD_Bitmap_Size_Y, Bitmap_Size_Y),
+    USAGE(UP_Alphanumeric_Display, AD_Bit_Depth_Format, Bit_Depth_Format),
+    USAGE(UP_Alphanumeric_Display, AD_Display_Orientation, Display_Orientation),
+    USAGE(UP_Alphanumeric_Display, AD_Palette_Report, Palette_Report),
+    USAGE(UP_Alphanumeric_Display, AD_Palette_Data_Size, Palette_Data_Size),
+    USAGE(UP_Alphanumeric_Display, AD_Palette_Data_Offset, Palette_Data_Offset),
+    USAGE(UP_Alphanumeric_Display, AD_Palette_Data, Palette_Data),
+    USAGE(UP_Alphanumeric_Display, AD_Blit_Report, Blit_Report),
+    USAGE(UP_Alphanumeric_Display, AD_Blit_Rectangle_X1, Blit_Rectangle_X1),
+    USAGE(UP_Alphanumeric_Display, AD_Blit_Rectangle_Y1, Blit_Rectangle_Y1),
+    USAGE(UP_Alphanumeric_Display, AD_Blit_Rectangle_X2, Blit_Rectangle_X2),
+    USAGE(UP_Alphanumeric_Display, AD_Blit_Rectangle_Y2, Blit_Rectangle_Y2),
+    USAGE(UP_Alphanumeric_Display, AD_Blit_Data, Blit_Data),
+    USAGE(UP_Alphanumeric_Display, AD_Soft_Button, Soft_Button),
+    USAGE(UP_Alphanumeric_Display, AD_Soft_Button_ID, Soft_Button_ID),
+    USAGE(UP_Alphanumeric_Display, AD_Soft_Button_Side, Soft_Button_Side),
+    USAGE(UP_Alphanumeric_Display, AD_Soft_Button_Offset_1, Soft_Button_Offset_1),
+    USAGE(UP_Alphanumeric_Display, AD_Soft_Button_Offset_2, Soft_Button_Offset_2),
+    USAGE(UP_Alphanumeric_Display, AD_Soft_Button_Report, Soft_Button_Report),
+    USAGE(UP_Medical_Instruments, MI_Medical_Ultrasound, Medical_Ultrasound),
+    USAGE(UP_Medical_Instruments, MI_VCR_Acquisition, VCR_Acquisition),
+    USAGE(UP_Medical_Instruments, MI_Freeze_Thaw, Freeze_Thaw),
+    USAGE(UP_Medical_Instruments, MI_Clip_Store, Clip_Store),
+    USAGE(UP_Medical_Instruments, MI_Update, Update),
+    USAGE(UP_Medical_Instruments, MI_Next, Next),
+    USAGE(UP_Medical_Instruments, MI_Save, Save),
+    USAGE(UP_Medical_Instruments, MI_Print, Print),
+    USAGE(UP_Medical_Instruments, MI_Microphone_Enable, Microphone_Enable),
+    USAGE(UP_Medical_Instruments, MI_Cine, Cine),
+    USAGE(UP_Medical_Instruments, MI_Transmit_Power, Transmit_Power),
+    USAGE(UP_Medical_Instruments, MI_Volume, Volume),
+    USAGE(UP_Medical_Instruments, MI_Focus, Focus),
+    USAGE(UP_Medical_Instruments, MI_Depth, Depth),
+    USAGE(UP_Medical_Instruments, MI_Soft_Step_Primary, Soft_Step_Primary),
+    USAGE(UP_Medical_Instruments, MI_Soft_Step_Secondary, Soft_Step_Secondary),
+    USAGE(UP_Medical_Instruments, MI_Depth_Gain_Compensation, Depth_Gain_Compensation),
+    USAGE(UP_Medical_Instruments, MI_Zoom_Select, Zoom_Select),
+    USAGE(UP_Medical_Instruments, MI_Zoom_Adjust, Zoom_Adjust),
+    USAGE(UP_Medical_Instruments, MI_Spectral_Doppler_Mode_Select, Spectral_Doppler_Mode_Select),
+    USAGE(UP_Medical_Instruments, MI_Spectral_Doppler_Adjust, Spectral_Doppler_Adjust),
+    USAGE(UP_Medical_Instruments, MI_Color_Doppler_Mode_Select, Color_Doppler_Mode_Select),
+    USAGE(UP_Medical_Instruments, MI_Color_Doppler_Adjust, Color_Doppler_Adjust),
+    USAGE(UP_Medical_Instruments, MI_Motion_Mode_Select, Motion_Mode_Select),
+    USAGE(UP_Medical_Instruments, MI_Motion_Mode_Adjust, Motion_Mode_Adjust),
+    USAGE(UP_Medical_Instruments, MI_2D_Mode_Select, N2_D_Mode_Select),
+    USAGE(UP_Medical_Instruments, MI_2D_Mode_Adjust, N2_D_Mode_Adjust),
+    USAGE(UP_Medical_Instruments, MI_Soft_Control_Select, Soft_Control_Select),
+    USAGE(UP_Medical_Instruments, MI_Soft_Control_Adjust, Soft_Control_Adjust),
+};
 
-const char *ri_Power(int32_t usage)
-{
-    switch(usage)
-    {
-    /* HID 1.11 Chapter 3 Table 1 says that
-    ** USB Device Class Definitrion for Power Device
-    ** This document didn't describe details.
-    */
-    default:
-        return "Unknown";
-    }
-}
+#undef USAGE
 
-const char *ri_BarCodeScanner(int32_t usage)
-{
-    switch(usage)
-    {
-    /* HID 1.11 Chapter 3 Table 1 says that
-    ** USB Device Class Definitrion for Point of Sale Device
-    ** This document didn't describe details.
-    */
-    default:
-        return "Unknown";
-    }
-}
+#define NUM_USAGES (sizeof(s_usages) / sizeof(s_usages[0]))
 
-const char *ri_Scale(int32_t usage)
-{
-    switch(usage)
-    {
-    /* HID 1.11 Chapter 3 Table 1 says that
-    ** USB Device Class Definitrion for Point of Sale Device
-    ** This document didn't describe details.
-    */
-    default:
-        return "Unknown";
-    }
-}
+/* Pages whose usages are numbers rather than names */
+static const struct {
+    uint16_t page;
+    const char *format;
+} s_numbered_pages[] = {
+    { UP_Button, "Button %d" },
+    { UP_Ordinal, "Instance %d" },
+};
 
-const char *ri_MSRDevices(int32_t usage)
+const char *ri_Usage(int32_t usagePage, int32_t usage,
+                     char *buffer, size_t size)
 {
-    /* Megnetic Stripe Reading Device */
-    switch(usage)
+    for (size_t i = 0; i < sizeof(s_numbered_pages) / sizeof(s_numbered_pages[0]); i++)
     {
-    /* HID 1.11 Chapter 3 Table 1 says that
-    ** USB Device Class Definitrion for Point of Sale Device
-    ** This document didn't describe details.
-    */
-    default:
-        return "Unknown";
+        if (s_numbered_pages[i].page == usagePage)
+        {
+            snprintf(buffer, size, s_numbered_pages[i].format, usage);
+            return buffer;
+        }
     }
-}
 
-const char *ri_CameraControl(int32_t usage)
-{
-    switch(usage)
-    {
-    /* HID 1.11 Chapter 3 Table 1 says that
-    ** USB Device Class Definitrion for Image Class Device
-    ** This document didn't describe details.
-    */
-    default:
+    if (usagePage < 0 || usagePage > 0xFFFF || usage < 0 || usage > 0xFFFF)
         return "Unknown";
-    }
-}
 
-const char *ri_Arcade(int32_t usage)
-{
-    switch(usage)
+    uint32_t key = ((uint32_t)usagePage << 16) | (uint32_t)usage;
+    size_t lo = 0, hi = NUM_USAGES;
+    while (lo < hi)
     {
-    /* HID 1.11 Chapter 3 Table 1 says that
-    ** OAAF Definitrion for arcade and coinop related Devices
-    ** This document didn't describe details.
-    */
-    default:
-        return "Unknown";
+        size_t mid = (lo + hi) / 2;
+        if (s_usages[mid].key < key)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
-}
+    if (lo < NUM_USAGES && s_usages[lo].key == key)
+        return (const char *)&s_names + s_usages[lo].name;
 
-const char *ri_Usage(int32_t usagePage, int32_t usage)
-{
-    switch(usagePage)
-    {
-    case UP_Generic_Desktop:
-        return ri_GenericDesktop(usage);
-    case UP_Simulation_Controls:
-        return ri_SimulationControls(usage);
-    case UP_VR_Controls:
-        return ri_VRControls(usage);
-    case UP_Sport_Controls:
-        return ri_SportControls(usage);
-    case UP_Game_Controls:
-        return ri_GameControls(usage);
-    case UP_Generic_Device_Controls:
-        return ri_GenericDeviceControls(usage);
-    case UP_Keyboard_or_Keypad:
-        return ri_KeyboardOrKeypad(usage);
-    case UP_LEDs:
-        return ri_LEDs(usage);
-    case UP_Button:
-        return ri_Button(usage);
-    case UP_Ordinal:
-        return ri_Ordinal(usage);
-    case UP_Telephony:
-        return ri_Telephony(usage);
-    case UP_Consumer:
-        return ri_Consumer(usage);
-    case UP_Digitizer:
-        return ri_Digitizer(usage);
-    case UP_PID_Page:
-        return ri_PIDPage(usage);
-    case UP_Unicode:
-        return ri_Unicode(usage);
-    case UP_Alphanumeric_Display:
-        return ri_AlphanumericDisplay(usage);
-    case UP_Medical_Instruments:
-        return ri_MedicalInstruments(usage);
-    // case UP_Monitor_pages_1:
-    // case UP_Monitor_pages_2:
-    // case UP_Monitor_pages_3:
-    // case UP_Monitor_pages_4:
-    //     return ri_Monitor(usage);
-    // case UP_Power_pages_1:
-    // case UP_Power_pages_2:
-    // case UP_Power_pages_3:
-    // case UP_Power_pages_4:
-    //     return ri_Power(usage);
-    // case UP_Bar_Code_Scanner_page:
-    //     return ri_BarCodeScanner(usage);
-    // case UP_Scale_page:
-    //     return ri_Scale(usage);
-    // case UP_MSR_Devices:
-    //     return ri_MSRDevices(usage);
-    // case UP_Camera_Control_Page:
-    //     return ri_CameraControl(usage);
-    // case UP_Arcade_Page:
-    //     return ri_Arcade(usage);
-    default:
-        return "Unknown";
-    }
+    return "Unknown";
 }
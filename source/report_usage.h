@@ -6,6 +6,8 @@
 
 #include "report_item.h"
 
+#include <stddef.h>
+
 /* Usage Page: Generic Desktop (0x01U)
 ** Sys: System
 */
@@ -984,7 +986,9 @@
 extern "C" {
 #endif
 
-const char *ri_Usage(int32_t usagePage, int32_t usage);
+/* buffer is used for the usages which are formatted rather than looked up */
+const char *ri_Usage(int32_t usagePage, int32_t usage,
+                     char *buffer, size_t size);
 
 #ifdef __cplusplus
 }
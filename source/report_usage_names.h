@@ -0,0 +1,802 @@
+/* Names of the usages in the HID Usage Tables 1.12, each listed once. This
+** file is included by report_usage.c with NAME() defined as needed.
+*/
+
+NAME(Pointer, "Pointer")
+NAME(Mouse, "Mouse")
+NAME(Joystick, "Joystick")
+NAME(Game_Pad, "Game Pad")
+NAME(Keyboard, "Keyboard")
+NAME(Keypad, "Keypad")
+NAME(Multi_axis_Controller, "Multi-axis Controller")
+NAME(Tablet_PC_System_Controls, "Tablet PC System Controls")
+NAME(X, "X")
+NAME(Y, "Y")
+NAME(Z, "Z")
+NAME(Rx, "Rx")
+NAME(Ry, "Ry")
+NAME(Rz, "Rz")
+NAME(Slider, "Slider")
+NAME(Dial, "Dial")
+NAME(Wheel, "Wheel")
+NAME(Switch, "Switch")
+NAME(Counted_Buffer, "Counted Buffer")
+NAME(Byte_Count, "Byte Count")
+NAME(Motion_Wakeup, "Motion Wakeup")
+NAME(Start, "Start")
+NAME(Select, "Select")
+NAME(Vx, "Vx")
+NAME(Vy, "Vy")
+NAME(Vz, "Vz")
+NAME(Vbrx, "Vbrx")
+NAME(Vbry, "Vbry")
+NAME(Vbrz, "Vbrz")
+NAME(Vno, "Vno")
+NAME(Feature_Notification, "Feature Notification")
+NAME(Resolution_Multiplier, "Resolution Multiplier")
+NAME(System_Control, "System Control")
+NAME(System_Power_Down, "System Power Down")
+NAME(System_Sleep, "System Sleep")
+NAME(System_Wake_Up, "System Wake Up")
+NAME(System_Context_Menu, "System Context Menu")
+NAME(System_Main_Menu, "System Main Menu")
+NAME(System_App_Menu, "System App Menu")
+NAME(System_Menu_Help, "System Menu Help")
+NAME(System_Menu_Exit, "System Menu Exit")
+NAME(System_Menu_Select, "System Menu Select")
+NAME(System_Menu_Right, "System Menu Right")
+NAME(System_Menu_Left, "System Menu Left")
+NAME(System_Menu_Up, "System Menu Up")
+NAME(System_Menu_Down, "System Menu Down")
+NAME(System_Cold_Restart, "System Cold Restart")
+NAME(System_Warm_Restart, "System Warm Restart")
+NAME(D_pad_Up, "D-pad Up")
+NAME(D_pad_Down, "D-pad Down")
+NAME(D_pad_Right, "D-pad Right")
+NAME(D_pad_Left, "D-pad Left")
+NAME(System_Dock, "System Dock")
+NAME(SYstem_Undock, "SYstem Undock")
+NAME(System_Setup, "System Setup")
+NAME(System_Break, "System Break")
+NAME(System_Debugger_Break, "System Debugger Break")
+NAME(Application_Break, "Application Break")
+NAME(Application_Debugger_Break, "Application Debugger Break")
+NAME(System_Speaker_Mute, "System Speaker Mute")
+NAME(System_Hibernate, "System Hibernate")
+NAME(System_Display_Invert, "System Display Invert")
+NAME(System_Display_Internal, "System Display Internal")
+NAME(System_Display_External, "System Display External")
+NAME(System_Display_Both, "System Display Both")
+NAME(System_Display_Dual, "System Display Dual")
+NAME(System_Display_Toggle, "System Display Toggle")
+NAME(System_Display_Swap, "System Display Swap")
+NAME(System_Display_LCD_Autoscale, "System Display LCD Autoscale")
+NAME(Flight_Simulation_Device, "Flight Simulation Device")
+NAME(Automobile_Simulation_Device, "Automobile Simulation Device")
+NAME(Tank_Simulation_Device, "Tank Simulation Device")
+NAME(Spaceship_Simulation_Device, "Spaceship Simulation Device")
+NAME(Submarine_Simulation_Device, "Submarine Simulation Device")
+NAME(Sailing_Simulation_Device, "Sailing Simulation Device")
+NAME(Motorcycle_Simulation_Device, "Motorcycle Simulation Device")
+NAME(Sports_Simulation_Device, "Sports Simulation Device")
+NAME(Airplane_Simulation_Device, "Airplane Simulation Device")
+NAME(Helicopter_Simulation_Device, "Helicopter Simulation Device")
+NAME(MagicCarpet_Simulation_Device, "MagicCarpet Simulation Device")
+NAME(Bicycle_Simulation_Device, "Bicycle Simulation Device")
+NAME(Flight_Control_Stick, "Flight Control Stick")
+NAME(Flilght_Stick, "Flilght Stick")
+NAME(Cyclic_Control, "Cyclic Control")
+NAME(Cyclic_Trim, "Cyclic Trim")
+NAME(Flight_Yoke, "Flight Yoke")
+NAME(Track_Control, "Track Control")
+NAME(Aileron, "Aileron")
+NAME(Aileron_Trim, "Aileron Trim")
+NAME(Anti_Torque_Control, "Anti Torque Control")
+NAME(Autopilot_Enable, "Autopilot Enable")
+NAME(Chaff_Release, "Chaff Release")
+NAME(Collective_Control, "Collective Control")
+NAME(Dive_Brake, "Dive Brake")
+NAME(Electronic_Countermeasures, "Electronic Countermeasures")
+NAME(Elevator, "Elevator")
+NAME(Elevator_Trim, "Elevator Trim")
+NAME(Rudder, "Rudder")
+NAME(Throttle, "Throttle")
+NAME(Flight_Communications, "Flight Communications")
+NAME(Flare_Release, "Flare Release")
+NAME(Landing_Gear, "Landing Gear")
+NAME(Toe_Brake, "Toe Brake")
+NAME(Trigger, "Trigger")
+NAME(Weapons_Arm, "Weapons Arm")
+NAME(Weapons_Select, "Weapons Select")
+NAME(Wing_Flaps, "Wing Flaps")
+NAME(Accelerator, "Accelerator")
+NAME(Brake, "Brake")
+NAME(Clutch, "Clutch")
+NAME(Shifter, "Shifter")
+NAME(Steering, "Steering")
+NAME(Turret_Direction, "Turret Direction")
+NAME(Barrel_Elevation, "Barrel Elevation")
+NAME(Dive_Plane, "Dive Plane")
+NAME(Ballast, "Ballast")
+NAME(Bicycle_Crank, "Bicycle Crank")
+NAME(Handle_Bars, "Handle Bars")
+NAME(Front_Brake, "Front Brake")
+NAME(Rear_Brake, "Rear Brake")
+NAME(Belt, "Belt")
+NAME(Body_Suit, "Body Suit")
+NAME(Flexor, "Flexor")
+NAME(Glove, "Glove")
+NAME(Head_Tracker, "Head Tracker")
+NAME(Head_Mounted_Display, "Head Mounted Display")
+NAME(Hand_Tracker, "Hand Tracker")
+NAME(Oculometer, "Oculometer")
+NAME(Vest, "Vest")
+NAME(Animatronic_Device, "Animatronic Device")
+NAME(Stereo_Enable, "Stereo Enable")
+NAME(Display_Enable, "Display Enable")
+NAME(Baseball_Bat, "Baseball Bat")
+NAME(Golf_Club, "Golf Club")
+NAME(Rowing_Machine, "Rowing Machine")
+NAME(Treadmill, "Treadmill")
+NAME(Oar, "Oar")
+NAME(Slope, "Slope")
+NAME(Rate, "Rate")
+NAME(Stick_Speed, "Stick Speed")
+NAME(Stick_Face_Angle, "Stick Face Angle")
+NAME(Stick_HeelorToe, "Stick HeelorToe")
+NAME(Stick_Follow_Through, "Stick Follow Through")
+NAME(Stick_Tempo, "Stick Tempo")
+NAME(Stick_Type, "Stick Type")
+NAME(Stick_Height, "Stick Height")
+NAME(Putter, "Putter")
+NAME(Iron, "Iron")
+NAME(Sand_Wedge, "Sand Wedge")
+NAME(Loft_Wedge, "Loft Wedge")
+NAME(Power_Wedge, "Power Wedge")
+NAME(Wood, "Wood")
+NAME(N3D_Game_Controller, "3D Game Controller ")
+NAME(Pinball_Device, "Pinball Device ")
+NAME(Gun_Device, "Gun Device")
+NAME(Point_of_View, "Point of View")
+NAME(Turn_Right_Left, "Turn Right/Left")
+NAME(Pitch_Forward_Backward, "Pitch Forward/Backward")
+NAME(Roll_Right_Left, "Roll Right/Left")
+NAME(Move_Right_Left, "Move Right/Left")
+NAME(Move_Forward_Backward, "Move Forward/Backward")
+NAME(Move_Up_Down, "Move Up/Down")
+NAME(Lean_Right_Left, "Lean Right/Left")
+NAME(Lean_Forward_Backward, "Lean Forward/Backward")
+NAME(Height_of_POV, "Height of POV")
+NAME(Flipper, "Flipper")
+NAME(Secondary_Flipper, "Secondary Flipper")
+NAME(Bump, "Bump")
+NAME(New_Game, "New Game")
+NAME(Shoot_Ball, "Shoot Ball")
+NAME(Player, "Player")
+NAME(Gun_Bolt, "Gun Bolt")
+NAME(Gun_Clip, "Gun Clip")
+NAME(Gun_Selector, "Gun Selector")
+NAME(Gun_Single_Shot, "Gun Single Shot")
+NAME(Gun_Burst, "Gun Burst")
+NAME(Gun_Automatic, "Gun Automatic")
+NAME(Gun_Safety, "Gun Safety")
+NAME(Gamepad_Fire_Jump, "Gamepad Fire/Jump")
+NAME(Gamepad_Trigger, "Gamepad Trigger")
+NAME(Battery_Strength, "Battery Strength")
+NAME(Wireless_Channel, "Wireless Channel")
+NAME(Wireless_ID, "Wireless ID")
+NAME(Discover_Wireless_Ctrl, "Discover Wireless Ctrl")
+NAME(Security_Code_Character_Entered, "Security Code Character Entered")
+NAME(Security_Code_Character_Cleared, "Security Code Character Cleared")
+NAME(Security_Code_Cleared, "Security Code Cleared")
+NAME(Num_Lock, "Num Lock")
+NAME(Caps_Lock, "Caps Lock")
+NAME(Scroll_Lock, "Scroll Lock")
+NAME(Compose, "Compose")
+NAME(Kana, "Kana")
+NAME(Power, "Power")
+NAME(Shift, "Shift")
+NAME(Donot_Disturb, "Donot Disturb")
+NAME(Mute, "Mute")
+NAME(Tone_Enable, "Tone Enable")
+NAME(High_Cut_Filter, "High Cut Filter")
+NAME(Low_Cut_Filter, "Low Cut Filter")
+NAME(Equalizer_Enable, "Equalizer Enable")
+NAME(Sound_Field_On, "Sound Field On")
+NAME(Surround_On, "Surround On")
+NAME(Repeat, "Repeat")
+NAME(Stereo, "Stereo")
+NAME(Sampling_Rate_Detect, "Sampling Rate Detect")
+NAME(Spinning, "Spinning")
+NAME(CAV, "CAV")
+NAME(CLV, "CLV")
+NAME(Recording_Format_Detect, "Recording Format Detect")
+NAME(Off_Hook, "Off-Hook")
+NAME(Ring, "Ring")
+NAME(Message_Waiting, "Message Waiting")
+NAME(Data_Mode, "Data Mode")
+NAME(Battery_Operation, "Battery Operation")
+NAME(Battery_OK, "Battery OK")
+NAME(Battery_LOW, "Battery LOW")
+NAME(Speaker, "Speaker")
+NAME(Head_Set, "Head Set")
+NAME(Hold, "Hold")
+NAME(Microphone, "Microphone")
+NAME(Coverage, "Coverage")
+NAME(Night_Mode, "Night Mode")
+NAME(Send_Calls, "Send Calls")
+NAME(Call_Pickup, "Call Pickup")
+NAME(Conference, "Conference")
+NAME(Standby, "Standby")
+NAME(Camera_On, "Camera On")
+NAME(Camera_Off, "Camera Off")
+NAME(On_Line, "On Line")
+NAME(Off_Line, "Off Line")
+NAME(Busy, "Busy")
+NAME(Ready, "Ready")
+NAME(Paper_Out, "Paper Out")
+NAME(Paper_Jam, "Paper Jam")
+NAME(Remote, "Remote")
+NAME(Forward, "Forward")
+NAME(Reverse, "Reverse")
+NAME(Stop, "Stop")
+NAME(Rewind, "Rewind")
+NAME(Fast_Forward, "Fast Forward")
+NAME(Play, "Play")
+NAME(Pause, "Pause")
+NAME(Record, "Record")
+NAME(Error, "Error")
+NAME(Selected_Indicator, "Selected Indicator")
+NAME(In_Use_Indicator, "In Use Indicator")
+NAME(Multi_Mode_Indicator, "Multi Mode Indicator")
+NAME(Indicator_On, "Indicator On")
+NAME(Indicator_Flash, "Indicator Flash")
+NAME(Indicator_Slow_Blink, "Indicator Slow Blink")
+NAME(Indicator_Fast_Blink, "Indicator Fast Blink")
+NAME(Indicator_Off, "Indicator Off")
+NAME(Flash_On_Time, "Flash On Time")
+NAME(Slow_Blink_On_Time, "Slow Blink On Time")
+NAME(Slow_Blink_Off_Time, "Slow Blink Off Time")
+NAME(Fast_Blink_On_Time, "Fast Blink On Time")
+NAME(Fast_Blink_Off_Time, "Fast Blink Off Time")
+NAME(Usage_Indicator_Color, "Usage Indicator Color")
+NAME(Indicator_Red, "Indicator Red")
+NAME(Indicator_Green, "Indicator Green")
+NAME(Indicator_Amber, "Indicator Amber")
+NAME(Generic_Indicator, "Generic Indicator")
+NAME(System_Suspend, "System Suspend")
+NAME(External_Power_Connected, "External Power Connected")
+NAME(Phone, "Phone")
+NAME(Answering_Machine, "Answering Machine")
+NAME(Message_Controls, "Message Controls")
+NAME(Handset, "Handset")
+NAME(Headset, "Headset")
+NAME(Telephony_Key_Pad, "Telephony Key Pad")
+NAME(Programmable_Button, "Programmable Button")
+NAME(Hook_Switch, "Hook Switch")
+NAME(Flash, "Flash")
+NAME(Feature, "Feature")
+NAME(Redial, "Redial")
+NAME(Transfer, "Transfer")
+NAME(Drop, "Drop")
+NAME(Park, "Park")
+NAME(Forward_Calls, "Forward Calls")
+NAME(Alternate_Function, "Alternate Function")
+NAME(Line, "Line")
+NAME(Speaker_Phone, "Speaker Phone")
+NAME(Ring_Enable, "Ring Enable")
+NAME(Ring_Select, "Ring Select")
+NAME(Phone_Mute, "Phone Mute")
+NAME(Caller_ID, "Caller ID")
+NAME(Send, "Send")
+NAME(Speed_Dial, "Speed Dial")
+NAME(Store_Number, "Store Number")
+NAME(Recall_Number, "Recall Number")
+NAME(Phone_Directory, "Phone Directory")
+NAME(Voice_Mail, "Voice Mail")
+NAME(Screen_Calls, "Screen Calls")
+NAME(Do_Not_Disturb, "Do Not Disturb")
+NAME(Message, "Message")
+NAME(Answer_On_Off, "Answer On/Off")
+NAME(Inside_Dial_Tone, "Inside Dial Tone")
+NAME(Outside_Dial_Tone, "Outside Dial Tone")
+NAME(Inside_Ring_Tone, "Inside Ring Tone")
+NAME(Outside_Ring_Tone, "Outside Ring Tone")
+NAME(Priority_Ring_Tone, "Priority Ring Tone")
+NAME(Inside_Ringback, "Inside Ringback")
+NAME(Priority_Ringback, "Priority Ringback")
+NAME(Line_Busy_Tone, "Line Busy Tone")
+NAME(Reorder_Tone, "Reorder Tone")
+NAME(Call_Waiting_Tone, "Call Waiting Tone")
+NAME(Confirmation_Tone_1, "Confirmation Tone 1")
+NAME(Confirmation_Tone_2, "Confirmation Tone 2")
+NAME(Tones_Off, "Tones Off")
+NAME(Outside_Ringback, "Outside Ringback")
+NAME(Ringer, "Ringer")
+NAME(Consumer_Control, "Consumer Control")
+NAME(Numeric_Key_Pad, "Numeric Key Pad")
+NAME(Programmable_Buttons, "Programmable Buttons")
+NAME(Headphone, "Headphone")
+NAME(Graphic_Equalizer, "Graphic Equalizer")
+NAME(N10, "+10")
+NAME(N100, "+100")
+NAME(AM_PM, "AM/PM")
+NAME(Reset, "Reset")
+NAME(Sleep, "Sleep")
+NAME(Sleep_After, "Sleep After")
+NAME(Sleep_Mode, "Sleep Mode")
+NAME(Illumination, "Illumination")
+NAME(Function_Buttons, "Function Buttons")
+NAME(Menu, "Menu")
+NAME(Menu_Pick, "Menu Pick")
+NAME(Menu_Up, "Menu Up")
+NAME(Menu_Down, "Menu Down")
+NAME(Menu_Left, "Menu Left")
+NAME(Menu_Right, "Menu Right")
+NAME(Menu_Escape, "Menu Escape")
+NAME(Menu_Value_Increase, "Menu Value Increase")
+NAME(Menu_Value_Decrease, "Menu Value Decrease")
+NAME(Data_On_Screen, "Data On Screen")
+NAME(Closed_Caption, "Closed Caption")
+NAME(Closed_Caption_Select, "Closed Caption Select")
+NAME(VCR_TV, "VCR/TV")
+NAME(Broadcast_Mode, "Broadcast Mode")
+NAME(Snapshot, "Snapshot")
+NAME(Still, "Still")
+NAME(Selection, "Selection")
+NAME(Assign_Selection, "Assign Selection")
+NAME(Mode_Step, "Mode Step")
+NAME(Recall_Last, "Recall Last")
+NAME(Enter_Channel, "Enter Channel")
+NAME(Order_Movie, "Order Movie")
+NAME(Channel, "Channel")
+NAME(Media_Selection, "Media Selection")
+NAME(Media_Select_Computer, "Media Select Computer")
+NAME(Media_Select_TV, "Media Select TV")
+NAME(Media_Select_WWW, "Media Select WWW")
+NAME(Media_Select_DVD, "Media Select DVD")
+NAME(Media_Select_Telephone, "Media Select Telephone")
+NAME(Media_Select_Program_Guide, "Media Select Program Guide")
+NAME(Media_Select_Video_Phone, "Media Select Video Phone")
+NAME(Media_Select_Games, "Media Select Games")
+NAME(Media_Select_Messages, "Media Select Messages")
+NAME(Media_Select_CD, "Media Select CD")
+NAME(Media_Select_VCR, "Media Select VCR")
+NAME(Media_Select_Tuner, "Media Select Tuner")
+NAME(Quit, "Quit")
+NAME(Help, "Help")
+NAME(Media_Select_Tape, "Media Select Tape")
+NAME(Media_Select_Cable, "Media Select Cable")
+NAME(Media_Select_Satellite, "Media Select Satellite")
+NAME(Media_Select_Security, "Media Select Security")
+NAME(Media_Select_Home, "Media Select Home")
+NAME(Media_Select_Call, "Media Select Call")
+NAME(Channel_Increment, "Channel Increment")
+NAME(Channel_Decrement, "Channel Decrement")
+NAME(Media_Select_SAP, "Media Select SAP")
+NAME(VCR_Plus, "VCR Plus")
+NAME(Once, "Once")
+NAME(Daily, "Daily")
+NAME(Weekly, "Weekly")
+NAME(Monthly, "Monthly")
+NAME(Scan_Next_Track, "Scan Next Track")
+NAME(Scan_Previous_Track, "Scan Previous Track")
+NAME(Eject, "Eject")
+NAME(Random_Play, "Random Play")
+NAME(Select_Disc, "Select Disc")
+NAME(Enter_Disc, "Enter Disc")
+NAME(Tracking, "Tracking")
+NAME(Track_Normal, "Track Normal")
+NAME(Slow_Tracking, "Slow Tracking")
+NAME(Frame_Forward, "Frame Forward")
+NAME(Frame_Back, "Frame Back")
+NAME(Mark, "Mark")
+NAME(Clear_Mark, "Clear Mark")
+NAME(Repeat_From_Mark, "Repeat From Mark")
+NAME(Return_To_Mark, "Return To Mark")
+NAME(Search_Mark_Forward, "Search Mark Forward")
+NAME(Search_Mark_Backwards, "Search Mark Backwards")
+NAME(Counter_Reset, "Counter Reset")
+NAME(Show_Counter, "Show Counter")
+NAME(Tracking_Increment, "Tracking Increment")
+NAME(Tracking_Decrement, "Tracking Decrement")
+NAME(Stop_Eject, "Stop/Eject")
+NAME(Play_Pause, "Play/Pause")
+NAME(Play_Skip, "Play/Skip")
+NAME(Volume, "Volume")
+NAME(Balance, "Balance")
+NAME(Bass, "Bass")
+NAME(Treble, "Treble")
+NAME(Bass_Boost, "Bass Boost")
+NAME(Surround_Mode, "Surround Mode")
+NAME(Loudness, "Loudness")
+NAME(MPX, "MPX")
+NAME(Volume_Increment, "Volume Increment")
+NAME(Volume_Decrement, "Volume Decrement")
+NAME(Speed_Select, "Speed Select")
+NAME(Playback_Speed, "Playback Speed")
+NAME(Standard_Play, "Standard Play")
+NAME(Long_Play, "Long Play")
+NAME(Extended_Play, "Extended Play")
+NAME(Slow, "Slow")
+NAME(Fan_Enable, "Fan Enable")
+NAME(Fan_Speed, "Fan Speed")
+NAME(Light_Enable, "Light Enable")
+NAME(Light_Illumination_Level, "Light Illumination Level")
+NAME(Climate_Control_Enable, "Climate Control Enable")
+NAME(Room_Temperature, "Room Temperature")
+NAME(Security_Enable, "Security Enable")
+NAME(Fire_Alarm, "Fire Alarm")
+NAME(Police_Alarm, "Police Alarm")
+NAME(Proximity, "Proximity")
+NAME(Motion, "Motion")
+NAME(Duress_Alarm, "Duress Alarm")
+NAME(Holdup_Alarm, "Holdup Alarm")
+NAME(Medical_Alarm, "Medical Alarm")
+NAME(Balance_Right, "Balance Right")
+NAME(Balance_Left, "Balance Left")
+NAME(Bass_Increment, "Bass Increment")
+NAME(Bass_Decrement, "Bass Decrement")
+NAME(Treble_Increment, "Treble Increment")
+NAME(Treble_Decrement, "Treble Decrement")
+NAME(Speaker_System, "Speaker System")
+NAME(Channel_Left, "Channel Left")
+NAME(Channel_Right, "Channel Right")
+NAME(Channel_Center, "Channel Center")
+NAME(Channel_Front, "Channel Front")
+NAME(Channel_Center_Front, "Channel Center Front")
+NAME(Channel_Side, "Channel Side")
+NAME(Channel_Surround, "Channel Surround")
+NAME(Channel_Low_Frequency_Enhancement, "Channel Low Frequency Enhancement")
+NAME(Channel_Top, "Channel Top")
+NAME(Channel_Unknown, "Channel Unknown")
+NAME(Sub_channel, "Sub-channel")
+NAME(Sub_channel_Increment, "Sub-channel Increment")
+NAME(Sub_channel_Decrement, "Sub-channel Decrement")
+NAME(Alternate_Audio_Increment, "Alternate Audio Increment")
+NAME(Alternate_Audio_Decrement, "Alternate Audio Decrement")
+NAME(Application_Launch_Buttons, "Application Launch Buttons")
+NAME(AL_Launch_Button_Configuration_Tool, "AL Launch Button Configuration Tool")
+NAME(AL_Programmable_Button_Configuration, "AL Programmable Button Configuration")
+NAME(AL_Consumer_Control_Configuration, "AL Consumer Control Configuration")
+NAME(AL_Word_Processor, "AL Word Processor")
+NAME(AL_Text_Editor, "AL Text Editor")
+NAME(AL_Spreadsheet, "AL Spreadsheet")
+NAME(AL_Graphics_Editor, "AL Graphics Editor")
+NAME(AL_Presentation_App, "AL Presentation App")
+NAME(AL_Database_App, "AL Database App")
+NAME(AL_Email_Reader, "AL Email Reader")
+NAME(AL_Newsreader, "AL Newsreader")
+NAME(AL_Voicemail, "AL Voicemail")
+NAME(AL_Contacts_Address_Book, "AL Contacts/Address Book")
+NAME(AL_Calendar_Schedule, "AL Calendar/Schedule")
+NAME(AL_Task_Project_Manager, "AL Task/Project Manager")
+NAME(AL_Log_Journal_Timecard, "AL Log/Journal/Timecard")
+NAME(AL_Checkbook_Finance, "AL Checkbook/Finance")
+NAME(AL_Calculator, "AL Calculator")
+NAME(AL_A_V_Capture_Playback, "AL A/V Capture/Playback")
+NAME(AL_Local_Machine_Browser, "AL Local Machine Browser")
+NAME(AL_LAN_WAN_Browser, "AL LAN/WAN Browser")
+NAME(AL_Internet_Browser, "AL Internet Browser")
+NAME(AL_Remote_Networking_ISP_Connect, "AL Remote Networking/ISP Connect")
+NAME(AL_Network_Conference, "AL Network Conference")
+NAME(AL_Network_Chat, "AL Network Chat")
+NAME(AL_Telephony_Dialer, "AL Telephony/Dialer")
+NAME(AL_Logon, "AL Logon")
+NAME(AL_Logoff, "AL Logoff")
+NAME(AL_Logon_Logoff, "AL Logon/Logoff")
+NAME(AL_Terminal_Lock_Screensaver, "AL Terminal Lock/Screensaver")
+NAME(AL_Control_Panel, "AL Control Panel")
+NAME(AL_Command_Line_Processor_Run, "AL Command Line Processor/Run")
+NAME(AL_Process_Task_Manager, "AL Process/Task Manager")
+NAME(AL_Select_Task_Application, "AL Select Task/Application")
+NAME(AL_Next_Task_Application, "AL Next Task/Application")
+NAME(AL_Previous_Task_Application, "AL Previous Task/Application")
+NAME(AL_Preemptive_Halt_Task_Application, "AL Preemptive Halt Task/Application")
+NAME(AL_Integrated_Help_Center, "AL Integrated Help Center")
+NAME(AL_Documents, "AL Documents")
+NAME(AL_Thesaurus, "AL Thesaurus")
+NAME(AL_Dictionary, "AL Dictionary")
+NAME(AL_Desktop, "AL Desktop")
+NAME(AL_Spell_Check, "AL Spell Check")
+NAME(AL_Grammar_Check, "AL Grammar Check")
+NAME(AL_Wireless_Status, "AL Wireless Status")
+NAME(AL_Keyboard_Layout, "AL Keyboard Layout")
+NAME(AL_Virus_Protection, "AL Virus Protection")
+NAME(AL_Encryption, "AL Encryption")
+NAME(AL_Screen_Saver, "AL Screen Saver")
+NAME(AL_Alarms, "AL Alarms")
+NAME(AL_Clock, "AL Clock")
+NAME(AL_File_Browser, "AL File Browser")
+NAME(AL_Power_Status, "AL Power Status")
+NAME(AL_Image_Browser, "AL Image Browser")
+NAME(AL_Audio_Browser, "AL Audio Browser")
+NAME(AL_Movie_Browser, "AL Movie Browser")
+NAME(AL_Digital_Rights_Manager, "AL Digital Rights Manager")
+NAME(AL_Digital_Wallet, "AL Digital Wallet")
+NAME(AL_Instant_Messaging, "AL Instant Messaging")
+NAME(AL_OEM_Features_Tips_Tutorial_Browser, "AL OEM Features/Tips/Tutorial Browser")
+NAME(AL_OEM_Help, "AL OEM Help")
+NAME(AL_Online_Community, "AL Online Community")
+NAME(AL_Entertainment_Content_Browser, "AL Entertainment Content Browser")
+NAME(AL_Online_Shopping_Browser, "AL Online Shopping Browser")
+NAME(AL_SmartCard_Information_Help, "AL SmartCard Information/Help")
+NAME(AL_Market_Monitor_Finance_Browser, "AL Market Monitor/Finance Browser")
+NAME(AL_Customized_Corporate_News_Browser, "AL Customized Corporate News Browser")
+NAME(AL_Online_Activity_Browser, "AL Online Activity Browser")
+NAME(AL_Research_Search_Browser, "AL Research/Search Browser")
+NAME(AL_Audio_Player, "AL Audio Player")
+NAME(Generic_GUI_Application_Controls, "Generic GUI Application Controls")
+NAME(AC_New, "AC New")
+NAME(AC_Open, "AC Open")
+NAME(AC_Close, "AC Close")
+NAME(AC_Exit, "AC Exit")
+NAME(AC_Maximize, "AC Maximize")
+NAME(AC_Minimize, "AC Minimize")
+NAME(AC_Save, "AC Save")
+NAME(AC_Print, "AC Print")
+NAME(AC_Properties, "AC Properties")
+NAME(AC_Undo, "AC Undo")
+NAME(AC_Copy, "AC Copy")
+NAME(AC_Cut, "AC Cut")
+NAME(AC_Paste, "AC Paste")
+NAME(AC_Select_All, "AC Select All")
+NAME(AC_Find, "AC Find")
+NAME(AC_Find_and_Replace, "AC Find and Replace")
+NAME(AC_Search, "AC Search")
+NAME(AC_Go_To, "AC Go To")
+NAME(AC_Home, "AC Home")
+NAME(AC_Back, "AC Back")
+NAME(AC_Forward, "AC Forward")
+NAME(AC_Stop, "AC Stop")
+NAME(AC_Refresh, "AC Refresh")
+NAME(AC_Previous_Link, "AC Previous Link")
+NAME(AC_Next_Link, "AC Next Link")
+NAME(AC_Bookmarks, "AC Bookmarks")
+NAME(AC_History, "AC History")
+NAME(AC_Subscriptions, "AC Subscriptions")
+NAME(AC_Zoom_In, "AC Zoom In")
+NAME(AC_Zoom_Out, "AC Zoom Out")
+NAME(AC_Zoom, "AC Zoom")
+NAME(AC_Full_Screen_View, "AC Full Screen View")
+NAME(AC_Normal_View, "AC Normal View")
+NAME(AC_View_Toggle, "AC View Toggle")
+NAME(AC_Scroll_Up, "AC Scroll Up")
+NAME(AC_Scroll_Down, "AC Scroll Down")
+NAME(AC_Scroll, "AC Scroll")
+NAME(AC_Pan_Left, "AC Pan Left")
+NAME(AC_Pan_Right, "AC Pan Right")
+NAME(AC_Pan, "AC Pan")
+NAME(AC_New_Window, "AC New Window")
+NAME(AC_Tile_Horizontally, "AC Tile Horizontally")
+NAME(AC_Tile_Vertically, "AC Tile Vertically")
+NAME(AC_Format, "AC Format")
+NAME(AC_Edit, "AC Edit")
+NAME(AC_Bold, "AC Bold")
+NAME(AC_Italics, "AC Italics")
+NAME(AC_Underline, "AC Underline")
+NAME(AC_Strikethrough, "AC Strikethrough")
+NAME(AC_Subscript, "AC Subscript")
+NAME(AC_Superscript, "AC Superscript")
+NAME(AC_All_Caps, "AC All Caps")
+NAME(AC_Rotate, "AC Rotate")
+NAME(AC_Resize, "AC Resize")
+NAME(AC_Flip_horizontal, "AC Flip horizontal")
+NAME(AC_Flip_Vertical, "AC Flip Vertical")
+NAME(AC_Mirror_Horizontal, "AC Mirror Horizontal")
+NAME(AC_Mirror_Vertical, "AC Mirror Vertical")
+NAME(AC_Font_Select, "AC Font Select")
+NAME(AC_Font_Color, "AC Font Color")
+NAME(AC_Font_Size, "AC Font Size")
+NAME(AC_Justify_Left, "AC Justify Left")
+NAME(AC_Justify_Center_H, "AC Justify Center H")
+NAME(AC_Justify_Right, "AC Justify Right")
+NAME(AC_Justify_Block_H, "AC Justify Block H")
+NAME(AC_Justify_Top, "AC Justify Top")
+NAME(AC_Justify_Center_V, "AC Justify Center V")
+NAME(AC_Justify_Bottom, "AC Justify Bottom")
+NAME(AC_Justify_Block_V, "AC Justify Block V")
+NAME(AC_Indent_Decrease, "AC Indent Decrease")
+NAME(AC_Indent_Increase, "AC Indent Increase")
+NAME(AC_Numbered_List, "AC Numbered List")
+NAME(AC_Restart_Numbering, "AC Restart Numbering")
+NAME(AC_Bulleted_List, "AC Bulleted List")
+NAME(AC_Promote, "AC Promote")
+NAME(AC_Demote, "AC Demote")
+NAME(AC_Yes, "AC Yes")
+NAME(AC_No, "AC No")
+NAME(AC_Cancel, "AC Cancel")
+NAME(AC_Catalog, "AC Catalog")
+NAME(AC_Buy_Checkout, "AC Buy/Checkout")
+NAME(AC_Add_to_Cart, "AC Add to Cart")
+NAME(AC_Expand, "AC Expand")
+NAME(AC_Expand_All, "AC Expand All")
+NAME(AC_Collapse, "AC Collapse")
+NAME(AC_Collapse_All, "AC Collapse All")
+NAME(AC_Print_Preview, "AC Print Preview")
+NAME(AC_Paste_Special, "AC Paste Special")
+NAME(AC_Insert_Mode, "AC Insert Mode")
+NAME(AC_Delete, "AC Delete")
+NAME(AC_Lock, "AC Lock")
+NAME(AC_Unlock, "AC Unlock")
+NAME(AC_Protect, "AC Protect")
+NAME(AC_Unprotect, "AC Unprotect")
+NAME(AC_Attach_Comment, "AC Attach Comment")
+NAME(AC_Delete_Comment, "AC Delete Comment")
+NAME(AC_View_Comment, "AC View Comment")
+NAME(AC_Select_Word, "AC Select Word")
+NAME(AC_Select_Sentence, "AC Select Sentence")
+NAME(AC_Select_Paragraph, "AC Select Paragraph")
+NAME(AC_Select_Column, "AC Select Column")
+NAME(AC_Select_Row, "AC Select Row")
+NAME(AC_Select_Table, "AC Select Table")
+NAME(AC_Select_Object, "AC Select Object")
+NAME(AC_Redo_Repeat, "AC Redo/Repeat")
+NAME(AC_Sort, "AC Sort")
+NAME(AC_Sort_Ascending, "AC Sort Ascending")
+NAME(AC_Sort_Descending, "AC Sort Descending")
+NAME(AC_Filter, "AC Filter")
+NAME(AC_Set_Clock, "AC Set Clock")
+NAME(AC_View_Clock, "AC View Clock")
+NAME(AC_Select_Time_Zone, "AC Select Time Zone")
+NAME(AC_Edit_Time_Zones, "AC Edit Time Zones")
+NAME(AC_Set_Alarm, "AC Set Alarm")
+NAME(AC_Clear_Alarm, "AC Clear Alarm")
+NAME(AC_Snooze_Alarm, "AC Snooze Alarm")
+NAME(AC_Reset_Alarm, "AC Reset Alarm")
+NAME(AC_Synchronize, "AC Synchronize")
+NAME(AC_Send_Receive, "AC Send/Receive")
+NAME(AC_Send_To, "AC Send To")
+NAME(AC_Reply, "AC Reply")
+NAME(AC_Reply_All, "AC Reply All")
+NAME(AC_Forward_Msg, "AC Forward Msg")
+NAME(AC_Send, "AC Send")
+NAME(AC_Attach_File, "AC Attach File")
+NAME(AC_Upload, "AC Upload")
+NAME(AC_Download_Save_Target_As, "AC Download (Save Target As)")
+NAME(AC_Set_Borders, "AC Set Borders")
+NAME(AC_Insert_Row, "AC Insert Row")
+NAME(AC_Insert_Column, "AC Insert Column")
+NAME(AC_Insert_File, "AC Insert File")
+NAME(AC_Insert_Picture, "AC Insert Picture")
+NAME(AC_Insert_Object, "AC Insert Object")
+NAME(AC_Insert_Symbol, "AC Insert Symbol")
+NAME(AC_Save_and_Close, "AC Save and Close")
+NAME(AC_Rename, "AC Rename")
+NAME(AC_Merge, "AC Merge")
+NAME(AC_Split, "AC Split")
+NAME(AC_Distribute_Horizontally, "AC Distribute Horizontally")
+NAME(AC_Distribute_Vertically, "AC Distribute Vertically")
+NAME(Digitizer, "Digitizer")
+NAME(Pen, "Pen")
+NAME(Light_Pen, "Light Pen")
+NAME(Touch_Screen, "Touch Screen")
+NAME(Touch_Pad, "Touch Pad")
+NAME(White_Board, "White Board")
+NAME(Coordinate_Measuring_Machine, "Coordinate Measuring Machine")
+NAME(N3D_Digitizer, "3D Digitizer")
+NAME(Stereo_Plotter, "Stereo Plotter")
+NAME(Articulated_Arm, "Articulated Arm")
+NAME(Armature, "Armature")
+NAME(Multiple_Point_Digitizer, "Multiple Point Digitizer ")
+NAME(Free_Space_Wand, "Free Space Wand")
+NAME(Stylus, "Stylus")
+NAME(Puck, "Puck")
+NAME(Finger, "Finger")
+NAME(Tip_Pressure, "Tip Pressure")
+NAME(Barrel_Pressure, "Barrel Pressure")
+NAME(In_Range, "In Range")
+NAME(Touch, "Touch")
+NAME(Untouch, "Untouch")
+NAME(Tap, "Tap")
+NAME(Quality, "Quality")
+NAME(Data_Valid, "Data Valid")
+NAME(Transducer_Index, "Transducer Index")
+NAME(Tablet_Function_Keys, "Tablet Function Keys")
+NAME(Program_Change_Keys, "Program Change Keys")
+NAME(Invert, "Invert")
+NAME(X_Tilt, "X Tilt")
+NAME(Y_Tilt, "Y Tilt")
+NAME(Azimuth, "Azimuth")
+NAME(Altitude, "Altitude ")
+NAME(Twist, "Twist ")
+NAME(Tip_Switch, "Tip Switch")
+NAME(Secondary_Tip_Switch, "Secondary Tip Switch ")
+NAME(Barrel_Switch, "Barrel Switch ")
+NAME(Eraser, "Eraser")
+NAME(Tablet_Pick, "Tablet Pick")
+NAME(Alphanumeric_Display, "Alphanumeric Display")
+NAME(Bitmapped_Display, "Bitmapped Display")
+NAME(Display_Attributes_Report, "Display Attributes Report")
+NAME(ASCII_Character_Set, "ASCII Character Set")
+NAME(Data_Read_Back, "Data Read Back")
+NAME(Font_Read_Back, "Font Read Back")
+NAME(Display_Control_Report, "Display Control Report")
+NAME(Clear_Display, "Clear Display")
+NAME(Screen_Saver_Delay, "Screen Saver Delay")
+NAME(Screen_Saver_Enable, "Screen Saver Enable")
+NAME(Vertical_Scroll, "Vertical Scroll")
+NAME(Horizontal_Scroll, "Horizontal Scroll")
+NAME(Character_Report, "Character Report")
+NAME(Display_Data, "Display Data")
+NAME(Display_Status, "Display Status")
+NAME(Stat_Not_Ready, "Stat Not Ready")
+NAME(Stat_Ready, "Stat Ready")
+NAME(Err_Not_a_loadable_character, "Err Not a loadable character")
+NAME(Err_Font_data_cannot_be_read, "Err Font data cannot be read")
+NAME(Cursor_Position_Report, "Cursor Position Report")
+NAME(Row, "Row")
+NAME(Column, "Column")
+NAME(Rows, "Rows")
+NAME(Columns, "Columns")
+NAME(Cursor_Pixel_Positioning, "Cursor Pixel Positioning")
+NAME(Cursor_Mode, "Cursor Mode")
+NAME(Cursor_Enable, "Cursor Enable")
+NAME(Cursor_Blink, "Cursor Blink")
+NAME(Font_Report, "Font Report")
+NAME(Font_Data, "Font Data")
+NAME(Character_Width, "Character Width")
+NAME(Character_Height, "Character Height")
+NAME(Character_Spacing_Horizontal, "Character Spacing Horizontal")
+NAME(Character_Spacing_Vertical, "Character Spacing Vertical")
+NAME(Unicode_Character_Set, "Unicode Character Set")
+NAME(Font_7_Segment, "Font 7-Segment")
+NAME(N7_Segment_Direct_Map, "7-Segment Direct Map")
+NAME(Font_14_Segment, "Font 14-Segment")
+NAME(N14_Segment_Direct_Map, "14-Segment Direct Map")
+NAME(Display_Brightness, "Display Brightness")
+NAME(Display_Contrast, "Display Contrast")
+NAME(Character_Attribute, "Character Attribute")
+NAME(Attribute_Readback, "Attribute Readback")
+NAME(Attribute_Data, "Attribute Data")
+NAME(Char_Attr_Enhance, "Char Attr Enhance")
+NAME(Char_Attr_Underline, "Char Attr Underline")
+NAME(Char_Attr_Blink, "Char Attr Blink")
+NAME(Bitmap_Size_X, "Bitmap Size X")
+NAME(Bitmap_Size_Y, "Bitmap Size Y")
+NAME(Bit_Depth_Format, "Bit Depth Format")
+NAME(Display_Orientation, "Display Orientation")
+NAME(Palette_Report, "Palette Report")
+NAME(Palette_Data_Size, "Palette Data Size")
+NAME(Palette_Data_Offset, "Palette Data Offset")
+NAME(Palette_Data, "Palette Data")
+NAME(Blit_Report, "Blit Report")
+NAME(Blit_Rectangle_X1, "Blit Rectangle X1")
+NAME(Blit_Rectangle_Y1, "Blit Rectangle Y1")
+NAME(Blit_Rectangle_X2, "Blit Rectangle X2")
+NAME(Blit_Rectangle_Y2, "Blit Rectangle Y2")
+NAME(Blit_Data, "Blit Data")
+NAME(Soft_Button, "Soft Button")
+NAME(Soft_Button_ID, "Soft Button ID")
+NAME(Soft_Button_Side, "Soft Button Side")
+NAME(Soft_Button_Offset_1, "Soft Button Offset 1")
+NAME(Soft_Button_Offset_2, "Soft Button Offset 2")
+NAME(Soft_Button_Report, "Soft Button Report")
+NAME(Medical_Ultrasound, "Medical Ultrasound")
+NAME(VCR_Acquisition, "VCR/Acquisition")
+NAME(Freeze_Thaw, "Freeze/Thaw")
+NAME(Clip_Store, "Clip Store")
+NAME(Update, "Update")
+NAME(Next, "Next")
+NAME(Save, "Save")
+NAME(Print, "Print")
+NAME(Microphone_Enable, "Microphone Enable")
+NAME(Cine, "Cine")
+NAME(Transmit_Power, "Transmit Power")
+NAME(Focus, "Focus")
+NAME(Depth, "Depth")
+NAME(Soft_Step_Primary, "Soft Step - Primary")
+NAME(Soft_Step_Secondary, "Soft Step - Secondary")
+NAME(Depth_Gain_Compensation, "Depth Gain Compensation")
+NAME(Zoom_Select, "Zoom Select")
+NAME(Zoom_Adjust, "Zoom Adjust")
+NAME(Spectral_Doppler_Mode_Select, "Spectral Doppler Mode Select")
+NAME(Spectral_Doppler_Adjust, "Spectral Doppler Adjust")
+NAME(Color_Doppler_Mode_Select, "Color Doppler Mode Select")
+NAME(Color_Doppler_Adjust, "Color Doppler Adjust")
+NAME(Motion_Mode_Select, "Motion Mode Select")
+NAME(Motion_Mode_Adjust, "Motion Mode Adjust")
+NAME(N2_D_Mode_Select, "2-D Mode Select")
+NAME(N2_D_Mode_Adjust, "2-D Mode Adjust")
+NAME(Soft_Control_Select, "Soft Control Select")
+NAME(Soft_Control_Adjust, "Soft Control Adjust")
@@ -0,0 +1,143 @@
+#include "sdp_cache.h"
+
+#include "bluetooth_sdp.h"
+#include "sdp_util.h"
+
+#include <fat.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define SDP_CACHE_MAGIC 0x53445043 /* "SDPC" */
+#define SDP_CACHE_VERSION 1
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t uuid;
+    uint32_t states_len;
+    uint32_t response_len;
+} SdpCacheHeader;
+
+static bool s_sdp_cache_available = false;
+
+bool sdp_cache_init()
+{
+    if (!fatInitDefault()) return false;
+
+    mkdir(SDP_CACHE_DIR, 0777);
+    s_sdp_cache_available = true;
+    return true;
+}
+
+bool sdp_cache_is_available()
+{
+    return s_sdp_cache_available;
+}
+
+static void sdp_cache_path(char *path, const uint8_t *bdaddr, uint16_t uuid)
+{
+    sprintf(path, SDP_CACHE_DIR "/%02x%02x%02x%02x%02x%02x-%04x.sdp",
+            bdaddr[0], bdaddr[1], bdaddr[2], bdaddr[3], bdaddr[4], bdaddr[5],
+            uuid);
+}
+
+static bool read_store(FILE *file, SdpStore *store, uint32_t len)
+{
+    uint8_t buffer[256];
+
+    while (len > 0) {
+        uint32_t chunk = len < sizeof(buffer) ? len : sizeof(buffer);
+        if (fread(buffer, 1, chunk, file) != chunk) return false;
+        if (!sdp_store_append(store, buffer, chunk)) return false;
+        len -= chunk;
+    }
+    return true;
+}
+
+static bool write_store(FILE *file, SdpStore *store)
+{
+    /* One block at a time, so nothing needs to be copied */
+    for (uint32_t offset = 0; offset < store->len;
+         offset += SDP_STORE_BLOCK_SIZE) {
+        uint32_t chunk = store->len - offset;
+        if (chunk > SDP_STORE_BLOCK_SIZE) chunk = SDP_STORE_BLOCK_SIZE;
+        const uint8_t *data = sdp_store_get(store, offset, chunk);
+        if (!data || fwrite(data, 1, chunk, file) != chunk) return false;
+    }
+    return true;
+}
+
+bool sdp_cache_load(const uint8_t *bdaddr, uint16_t uuid,
+                    SdpStore *states, SdpStore *response)
+{
+    if (!s_sdp_cache_available) return false;
+
+    char path[64];
+    sdp_cache_path(path, bdaddr, uuid);
+    FILE *file = fopen(path, "rb");
+    if (!file) return false;
+
+    SdpCacheHeader header;
+    bool ok = fread(&header, sizeof(header), 1, file) == 1 &&
+        header.magic == SDP_CACHE_MAGIC &&
+        header.version == SDP_CACHE_VERSION &&
+        header.uuid == uuid &&
+        read_store(file, states, header.states_len) &&
+        read_store(file, response, header.response_len);
+    fclose(file);
+
+    if (!ok) {
+        sdp_store_reset(states);
+        sdp_store_reset(response);
+    }
+    return ok;
+}
+
+bool sdp_cache_save(const uint8_t *bdaddr, uint16_t uuid,
+                    SdpStore *states, SdpStore *response)
+{
+    if (!s_sdp_cache_available) return false;
+
+    char path[64];
+    sdp_cache_path(path, bdaddr, uuid);
+    FILE *file = fopen(path, "wb");
+    if (!file) return false;
+
+    SdpCacheHeader header = {
+        .magic = SDP_CACHE_MAGIC,
+        .version = SDP_CACHE_VERSION,
+        .uuid = uuid,
+        .states_len = states->len,
+        .response_len = response->len,
+    };
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+        write_store(file, states) &&
+        write_store(file, response);
+    fclose(file);
+
+    /* Don't leave a half-written file behind */
+    if (!ok) remove(path);
+    return ok;
+}
+
+bool sdp_cache_states_usable(SdpStore *states)
+{
+    const uint8_t *list = sdp_store_get(states, 0, states->len);
+    if (!list || !de_validate(list, states->len, NULL) ||
+        de_get_element_type(list) != DE_DES) return false;
+
+    int num_records = 0;
+    de_cursor_t cursor;
+    de_cursor_init(&cursor, list, states->len);
+    de_cursor_next(&cursor, false);
+    while (de_cursor_next(&cursor, cursor.depth == 0)) {
+        uint8_t *record = (uint8_t *)de_cursor_element(&cursor);
+        if (!sdp_get_attribute_value_for_attribute_id(
+                record, BLUETOOTH_ATTRIBUTE_SERVICE_RECORD_STATE)) {
+            return false;
+        }
+        num_records++;
+    }
+    return num_records > 0;
+}
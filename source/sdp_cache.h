@@ -0,0 +1,34 @@
+#ifndef BTT_SDP_CACHE_H
+#define BTT_SDP_CACHE_H
+
+#include "sdp_store.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * SDP responses saved on the SD card, one file per device and service
+ * class. Each file also holds the ServiceRecordHandle and ServiceRecordState
+ * of the records as they were when the response was saved: a cached
+ * response is only good as long as the device reports the same.
+ */
+
+#define SDP_CACHE_DIR "sd:/wii-bt-tool"
+
+/* Returns false if there is no SD card to store the cache in */
+bool sdp_cache_init(void);
+bool sdp_cache_is_available(void);
+
+bool sdp_cache_load(const uint8_t *bdaddr, uint16_t uuid,
+                    SdpStore *states, SdpStore *response);
+bool sdp_cache_save(const uint8_t *bdaddr, uint16_t uuid,
+                    SdpStore *states, SdpStore *response);
+
+/*
+ * Returns true if every record in a ServiceSearchAttribute response for
+ * the handle and state has a ServiceRecordState: otherwise, changes to the
+ * records cannot be detected.
+ */
+bool sdp_cache_states_usable(SdpStore *states);
+
+#endif // BTT_SDP_CACHE_H
@@ -0,0 +1,366 @@
+#include "sdp_client.h"
+
+#include "btopt.h"
+#include "btstack_util.h"
+
+#include <string.h>
+
+/* PDU header, byte or record counts and the largest ContinuationState */
+#define SDP_ATTRIBUTE_RESPONSE_OVERHEAD (5 + 2 + 1 + 16)
+#define SDP_SEARCH_RESPONSE_OVERHEAD (5 + 4 + 1 + 16)
+/* Larger responses would be split over several L2CAP packets anyway */
+#define SDP_MAX_ATTRIBUTE_BYTES (L2CAP_MTU - SDP_ATTRIBUTE_RESPONSE_OVERHEAD)
+#define SDP_MAX_RECORDS ((L2CAP_MTU - SDP_SEARCH_RESPONSE_OVERHEAD) / 4)
+
+static void sdp_client_got_message(BtL2capHandle *handle, void *msg,
+                                   size_t len, void *cb_data);
+
+void sdp_client_init(SdpClient *client, BtL2capHandle *handle,
+                     int max_outstanding)
+{
+    memset(client, 0, sizeof(*client));
+    client->handle = handle;
+    client->max_outstanding = max_outstanding > 0 ? max_outstanding : 1;
+    if (handle) {
+        bt_l2cap_handle_notify(handle, sdp_client_got_message, client);
+    }
+}
+
+void sdp_client_reset(SdpClient *client)
+{
+    for (int i = 0; i < SDP_CLIENT_MAX_TRANSACTIONS; i++) {
+        client->transactions[i].state = SDP_TRANSACTION_FREE;
+    }
+}
+
+int sdp_client_num_pending(const SdpClient *client)
+{
+    int count = 0;
+    for (int i = 0; i < SDP_CLIENT_MAX_TRANSACTIONS; i++) {
+        if (client->transactions[i].state != SDP_TRANSACTION_FREE) count++;
+    }
+    return count;
+}
+
+static int sdp_client_num_sent(const SdpClient *client)
+{
+    int count = 0;
+    for (int i = 0; i < SDP_CLIENT_MAX_TRANSACTIONS; i++) {
+        if (client->transactions[i].state == SDP_TRANSACTION_SENT) count++;
+    }
+    return count;
+}
+
+/* Sends the request again with a new transaction ID and the current
+ * continuation state */
+static void sdp_client_send(SdpClient *client, SdpTransaction *t)
+{
+    uint8_t buffer[SDP_CLIENT_MAX_REQUEST_SIZE + 1 + 16];
+    int len = t->request_len;
+
+    t->id = client->next_transaction_id++;
+    t->state = SDP_TRANSACTION_SENT;
+
+    memcpy(buffer, t->request, len);
+    big_endian_store_16(buffer, 1, t->id);
+
+    //     ContinuationState - uint8_t number of cont. bytes N<=16
+    buffer[len++] = t->continuation_len;
+    if (t->continuation_len > 0) {
+        memcpy(buffer + len, t->continuation, t->continuation_len);
+        len += t->continuation_len;
+    }
+
+    // uint16_t paramLength
+    big_endian_store_16(buffer, 3, len - 5);
+    bt_l2cap_handle_write(client->handle, buffer, len);
+}
+
+/* Sends the queued requests, oldest first, as long as the pipeline allows */
+static void sdp_client_pump(SdpClient *client)
+{
+    while (sdp_client_num_sent(client) < client->max_outstanding) {
+        SdpTransaction *next = NULL;
+        for (int i = 0; i < SDP_CLIENT_MAX_TRANSACTIONS; i++) {
+            SdpTransaction *t = &client->transactions[i];
+            if (t->state != SDP_TRANSACTION_QUEUED) continue;
+            if (!next || t->sequence < next->sequence) next = t;
+        }
+        if (!next) break;
+        sdp_client_send(client, next);
+    }
+}
+
+static SdpTransaction *sdp_client_new_transaction(SdpClient *client,
+                                                  uint8_t pdu_id,
+                                                  SdpStore *dest,
+                                                  SdpClientCb callback,
+                                                  void *cb_data)
+{
+    for (int i = 0; i < SDP_CLIENT_MAX_TRANSACTIONS; i++) {
+        SdpTransaction *t = &client->transactions[i];
+        if (t->state != SDP_TRANSACTION_FREE) continue;
+
+        t->state = SDP_TRANSACTION_QUEUED;
+        t->continuation_len = 0;
+        t->dest = dest;
+        t->callback = callback;
+        t->cb_data = cb_data;
+        t->num_responses = 0;
+        t->sequence = client->next_sequence++;
+
+        t->request[0] = pdu_id;
+        /* The transaction ID and the parameters length are filled in when
+         * the request is sent */
+        t->request_len = 5;
+        return t;
+    }
+    return NULL;
+}
+
+static bool sdp_client_add_element(SdpTransaction *t, const uint8_t *element)
+{
+    uint32_t element_len = de_get_len(element);
+    if (t->request_len + element_len > SDP_CLIENT_MAX_REQUEST_SIZE) return false;
+
+    memcpy(t->request + t->request_len, element, element_len);
+    t->request_len += element_len;
+    return true;
+}
+
+static bool sdp_client_add_attributes(SdpTransaction *t,
+                                      const SdpAttributeRange *ranges,
+                                      int num_ranges)
+{
+    uint16_t len = sdp_attribute_id_list_build(t->request + t->request_len,
+                                               SDP_CLIENT_MAX_REQUEST_SIZE - t->request_len,
+                                               ranges, num_ranges);
+    t->request_len += len;
+    return len > 0;
+}
+
+bool sdp_client_service_search(SdpClient *client, const uint8_t *search_pattern,
+                               uint16_t max_records, SdpStore *dest,
+                               SdpClientCb callback, void *cb_data)
+{
+    SdpTransaction *t =
+        sdp_client_new_transaction(client, SDP_ServiceSearchRequest,
+                                   dest, callback, cb_data);
+    if (!t) return false;
+
+    if (!sdp_client_add_element(t, search_pattern)) {
+        t->state = SDP_TRANSACTION_FREE;
+        return false;
+    }
+
+    //     MaximumServiceRecordCount - uint16_t
+    if (max_records > SDP_MAX_RECORDS) max_records = SDP_MAX_RECORDS;
+    big_endian_store_16(t->request, t->request_len, max_records);
+    t->request_len += 2;
+    sdp_client_pump(client);
+    return true;
+}
+
+bool sdp_client_service_attribute(SdpClient *client, uint32_t record_handle,
+                                  const SdpAttributeRange *ranges,
+                                  int num_ranges, SdpStore *dest,
+                                  SdpClientCb callback, void *cb_data)
+{
+    SdpTransaction *t =
+        sdp_client_new_transaction(client, SDP_ServiceAttributeRequest,
+                                   dest, callback, cb_data);
+    if (!t) return false;
+
+    big_endian_store_32(t->request, t->request_len, record_handle);
+    t->request_len += 4;
+
+    //     MaximumAttributeByteCount - uint16_t  0x0007 - 0xffff -> mtu
+    big_endian_store_16(t->request, t->request_len, SDP_MAX_ATTRIBUTE_BYTES);
+    t->request_len += 2;
+
+    if (!sdp_client_add_attributes(t, ranges, num_ranges)) {
+        t->state = SDP_TRANSACTION_FREE;
+        return false;
+    }
+    sdp_client_pump(client);
+    return true;
+}
+
+bool sdp_client_service_search_attribute(SdpClient *client,
+                                         const uint8_t *search_pattern,
+                                         const SdpAttributeRange *ranges,
+                                         int num_ranges, SdpStore *dest,
+                                         SdpClientCb callback, void *cb_data)
+{
+    SdpTransaction *t =
+        sdp_client_new_transaction(client, SDP_ServiceSearchAttributeRequest,
+                                   dest, callback, cb_data);
+    if (!t) return false;
+
+    if (!sdp_client_add_element(t, search_pattern)) {
+        t->state = SDP_TRANSACTION_FREE;
+        return false;
+    }
+
+    //     MaximumAttributeByteCount - uint16_t  0x0007 - 0xffff -> mtu
+    big_endian_store_16(t->request, t->request_len, SDP_MAX_ATTRIBUTE_BYTES);
+    t->request_len += 2;
+
+    if (!sdp_client_add_attributes(t, ranges, num_ranges)) {
+        t->state = SDP_TRANSACTION_FREE;
+        return false;
+    }
+    sdp_client_pump(client);
+    return true;
+}
+
+/* Frees the transaction before calling back, so that the callback can
+ * issue new requests */
+static void sdp_client_finish(SdpClient *client, SdpTransaction *t,
+                              uint16_t error_code, uint16_t total_records)
+{
+    SdpClientResult result = {
+        .transaction_id = t->id,
+        .error_code = error_code,
+        .num_responses = t->num_responses,
+        .continuation_len = 0,
+        .total_records = total_records,
+        .complete = true,
+        .dest = t->dest,
+    };
+    SdpClientCb callback = t->callback;
+    void *cb_data = t->cb_data;
+
+    t->state = SDP_TRANSACTION_FREE;
+    if (callback) callback(client, &result, cb_data);
+}
+
+/* Fails all the requests waiting for a response: without a transaction ID
+ * there is no telling which one a message was meant for */
+static void sdp_client_fail_sent(SdpClient *client, uint16_t error_code)
+{
+    /* The callbacks may send new requests, which must not be failed */
+    bool failed[SDP_CLIENT_MAX_TRANSACTIONS];
+    for (int i = 0; i < SDP_CLIENT_MAX_TRANSACTIONS; i++) {
+        failed[i] = client->transactions[i].state == SDP_TRANSACTION_SENT;
+    }
+    for (int i = 0; i < SDP_CLIENT_MAX_TRANSACTIONS; i++) {
+        if (failed[i]) sdp_client_finish(client, &client->transactions[i],
+                                         error_code, 0);
+    }
+}
+
+static SdpTransaction *sdp_client_find(SdpClient *client, uint16_t id)
+{
+    for (int i = 0; i < SDP_CLIENT_MAX_TRANSACTIONS; i++) {
+        SdpTransaction *t = &client->transactions[i];
+        if (t->state == SDP_TRANSACTION_SENT && t->id == id) return t;
+    }
+    return NULL;
+}
+
+static void sdp_client_handle_response(SdpClient *client,
+                                       const uint8_t *response, int size)
+{
+    if (size == 0) {
+        sdp_client_fail_sent(client, SDP_CLIENT_ERROR_EMPTY);
+        return;
+    }
+    if (size < 5) {
+        sdp_client_fail_sent(client, SDP_CLIENT_ERROR_MALFORMED);
+        return;
+    }
+
+    /* Responses to requests which are no longer there are dropped */
+    SdpTransaction *t = sdp_client_find(client, big_endian_read_16(response, 1));
+    if (!t) return;
+
+    t->num_responses++;
+
+    uint8_t pdu_id = response[0];
+    uint16_t parameter_length = big_endian_read_16(response, 3);
+    int offset = 5;
+    if (offset + parameter_length > size) {
+        sdp_client_finish(client, t, SDP_CLIENT_ERROR_MALFORMED, 0);
+        return;
+    }
+    size = offset + parameter_length;
+
+    if (pdu_id == SDP_ErrorResponse) {
+        uint16_t error_code = size >= offset + 2 ?
+            big_endian_read_16(response, offset) : SDP_CLIENT_ERROR_MALFORMED;
+        sdp_client_finish(client, t, error_code, 0);
+        return;
+    }
+    if (pdu_id != t->request[0] + 1) {
+        sdp_client_finish(client, t, SDP_CLIENT_ERROR_MALFORMED, 0);
+        return;
+    }
+
+    uint16_t total_records = 0;
+    uint32_t data_len;
+    if (pdu_id == SDP_ServiceSearchResponse) {
+        // TotalServiceRecordCount, CurrentServiceRecordCount
+        if (offset + 4 > size) {
+            sdp_client_finish(client, t, SDP_CLIENT_ERROR_MALFORMED, 0);
+            return;
+        }
+        total_records = big_endian_read_16(response, offset);
+        data_len = big_endian_read_16(response, offset + 2) * 4;
+        offset += 4;
+    } else {
+        // AttributeListByteCount
+        if (offset + 2 > size) {
+            sdp_client_finish(client, t, SDP_CLIENT_ERROR_MALFORMED, 0);
+            return;
+        }
+        data_len = big_endian_read_16(response, offset);
+        offset += 2;
+    }
+
+    /* 1 byte for continuation state */
+    if (offset + data_len + 1 > size) {
+        sdp_client_finish(client, t, SDP_CLIENT_ERROR_MALFORMED, total_records);
+        return;
+    }
+    if (!sdp_store_append(t->dest, response + offset, data_len)) {
+        sdp_client_finish(client, t, SDP_CLIENT_ERROR_NO_SPACE, total_records);
+        return;
+    }
+    offset += data_len;
+
+    uint8_t continuation_len = response[offset++];
+    if (continuation_len > 16 || offset + continuation_len > size) {
+        sdp_client_finish(client, t, SDP_CLIENT_ERROR_MALFORMED, total_records);
+        return;
+    }
+    if (continuation_len == 0) {
+        sdp_client_finish(client, t, 0, total_records);
+        return;
+    }
+
+    memcpy(t->continuation, response + offset, continuation_len);
+    t->continuation_len = continuation_len;
+
+    SdpClientResult result = {
+        .transaction_id = t->id,
+        .error_code = 0,
+        .num_responses = t->num_responses,
+        .continuation_len = continuation_len,
+        .total_records = total_records,
+        .complete = false,
+        .dest = t->dest,
+    };
+    /* The transaction keeps its place in the pipeline */
+    sdp_client_send(client, t);
+    if (t->callback) t->callback(client, &result, t->cb_data);
+}
+
+static void sdp_client_got_message(BtL2capHandle *handle, void *msg,
+                                   size_t len, void *cb_data)
+{
+    SdpClient *client = cb_data;
+
+    sdp_client_handle_response(client, msg, len);
+    sdp_client_pump(client);
+}
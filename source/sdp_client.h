@@ -0,0 +1,103 @@
+#ifndef BTT_SDP_CLIENT_H
+#define BTT_SDP_CLIENT_H
+
+#include "bluetooth.h"
+#include "sdp_store.h"
+#include "sdp_util.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * SDP requests issued over one L2CAP channel. Each request is a
+ * transaction which owns its continuation state: several of them can be
+ * queued at once, and responses are routed to them by transaction ID.
+ * Fragments of a response are appended to the store given with the
+ * request, so each outstanding request needs a store of its own.
+ */
+
+#define SDP_CLIENT_MAX_TRANSACTIONS 8
+/* Large enough for a full ServiceSearchPattern and AttributeIDList */
+#define SDP_CLIENT_MAX_REQUEST_SIZE 320
+
+/* Error codes beyond those sent in an SDP_ErrorResponse */
+#define SDP_CLIENT_ERROR_EMPTY 0x0100
+#define SDP_CLIENT_ERROR_MALFORMED 0x0101
+#define SDP_CLIENT_ERROR_NO_SPACE 0x0102
+#define SDP_CLIENT_ERROR_CANCELLED 0x0103
+
+typedef struct _sdp_client SdpClient;
+
+typedef struct {
+    uint16_t transaction_id; /* of the last fragment */
+    uint16_t error_code;
+    /* Number of response PDUs received so far */
+    int num_responses;
+    uint8_t continuation_len;
+    /* ServiceSearch only: the store receives the 32-bit record handles */
+    uint16_t total_records;
+    bool complete;
+    SdpStore *dest;
+} SdpClientResult;
+
+/* Called for every response PDU; complete is set on the last one */
+typedef void (*SdpClientCb)(SdpClient *client, const SdpClientResult *result,
+                            void *cb_data);
+
+typedef enum {
+    SDP_TRANSACTION_FREE = 0,
+    SDP_TRANSACTION_QUEUED,
+    SDP_TRANSACTION_SENT,
+} SdpTransactionState;
+
+typedef struct {
+    SdpTransactionState state;
+    uint16_t id;
+    /* The request PDU, up to (excluded) the continuation state */
+    uint8_t request[SDP_CLIENT_MAX_REQUEST_SIZE];
+    uint16_t request_len;
+    uint8_t continuation_len;
+    uint8_t continuation[16];
+    SdpStore *dest;
+    SdpClientCb callback;
+    void *cb_data;
+    int num_responses;
+    uint32_t sequence; /* requests are sent in the order they were made */
+} SdpTransaction;
+
+struct _sdp_client {
+    BtL2capHandle *handle;
+    uint16_t next_transaction_id;
+    uint32_t next_sequence;
+    /* Requests sent before any response is awaited; 1 means serial */
+    int max_outstanding;
+    SdpTransaction transactions[SDP_CLIENT_MAX_TRANSACTIONS];
+};
+
+/* Takes over the notifications of handle */
+void sdp_client_init(SdpClient *client, BtL2capHandle *handle,
+                     int max_outstanding);
+/* Drops all requests without calling their callbacks */
+void sdp_client_reset(SdpClient *client);
+int sdp_client_num_pending(const SdpClient *client);
+
+/*
+ * These return false if all the transactions are in use, or if the request
+ * is too large. Attributes are asked as a list of ranges; the amount of data
+ * asked per response, as well as the number of record handles, is limited
+ * so that each response fits in a single L2CAP packet.
+ */
+bool sdp_client_service_search(SdpClient *client, const uint8_t *search_pattern,
+                               uint16_t max_records, SdpStore *dest,
+                               SdpClientCb callback, void *cb_data);
+bool sdp_client_service_attribute(SdpClient *client, uint32_t record_handle,
+                                  const SdpAttributeRange *ranges,
+                                  int num_ranges, SdpStore *dest,
+                                  SdpClientCb callback, void *cb_data);
+bool sdp_client_service_search_attribute(SdpClient *client,
+                                         const uint8_t *search_pattern,
+                                         const SdpAttributeRange *ranges,
+                                         int num_ranges, SdpStore *dest,
+                                         SdpClientCb callback, void *cb_data);
+
+#endif // BTT_SDP_CLIENT_H
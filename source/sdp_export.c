@@ -0,0 +1,429 @@
+#include "sdp_export.h"
+
+#include "btstack_util.h"
+#include "sdp_cache.h"
+#include "sdp_util.h"
+
+#include <string.h>
+#include <sys/stat.h>
+
+#define SDP_EXPORT_DIR SDP_CACHE_DIR "/export"
+
+/* CBOR major types and simple values */
+#define CBOR_UINT 0x00
+#define CBOR_NEGINT 0x20
+#define CBOR_BYTES 0x40
+#define CBOR_TEXT 0x60
+#define CBOR_ARRAY 0x80
+#define CBOR_MAP 0xa0
+#define CBOR_TAG 0xc0
+#define CBOR_FALSE 0xf4
+#define CBOR_TRUE 0xf5
+#define CBOR_NULL 0xf6
+#define CBOR_INDEFINITE 0x1f
+#define CBOR_BREAK 0xff
+#define CBOR_TAG_URI 32
+#define CBOR_TAG_UUID 37
+
+static void writer_flush(SdpExportWriter *writer)
+{
+    if (writer->len > 0 && !writer->error &&
+        fwrite(writer->buffer, 1, writer->len, writer->file) != writer->len) {
+        writer->error = true;
+    }
+    writer->len = 0;
+}
+
+static void writer_put(SdpExportWriter *writer, const void *data, uint32_t len)
+{
+    const uint8_t *src = data;
+    while (len > 0) {
+        if (writer->len == SDP_EXPORT_BUFFER_SIZE) writer_flush(writer);
+        uint32_t chunk = SDP_EXPORT_BUFFER_SIZE - writer->len;
+        if (chunk > len) chunk = len;
+        memcpy(writer->buffer + writer->len, src, chunk);
+        writer->len += chunk;
+        src += chunk;
+        len -= chunk;
+    }
+}
+
+static void writer_putc(SdpExportWriter *writer, uint8_t c)
+{
+    writer_put(writer, &c, 1);
+}
+
+static void writer_puts(SdpExportWriter *writer, const char *text)
+{
+    writer_put(writer, text, strlen(text));
+}
+
+/* MARK: CBOR */
+
+static void cbor_head(SdpExportWriter *writer, uint8_t major, uint64_t value)
+{
+    uint8_t head[9];
+    int len;
+
+    if (value < 24) {
+        head[0] = major | value;
+        len = 1;
+    } else if (value <= 0xff) {
+        head[0] = major | 24;
+        head[1] = value;
+        len = 2;
+    } else if (value <= 0xffff) {
+        head[0] = major | 25;
+        big_endian_store_16(head, 1, value);
+        len = 3;
+    } else if (value <= 0xffffffff) {
+        head[0] = major | 26;
+        big_endian_store_32(head, 1, value);
+        len = 5;
+    } else {
+        head[0] = major | 27;
+        big_endian_store_32(head, 1, value >> 32);
+        big_endian_store_32(head, 5, value);
+        len = 9;
+    }
+    writer_put(writer, head, len);
+}
+
+static void cbor_data(SdpExportWriter *writer, uint8_t major,
+                      const void *data, uint32_t len)
+{
+    cbor_head(writer, major, len);
+    writer_put(writer, data, len);
+}
+
+/* MARK: JSON */
+
+/* The bodies of JSON strings, without the quotes, so that long ones can be
+ * written a chunk at a time */
+static void json_hex_chunk(SdpExportWriter *writer, const uint8_t *data,
+                           uint32_t len)
+{
+    static const char digits[] = "0123456789abcdef";
+
+    for (uint32_t i = 0; i < len; i++) {
+        writer_putc(writer, digits[data[i] >> 4]);
+        writer_putc(writer, digits[data[i] & 0xf]);
+    }
+}
+
+static void json_hex(SdpExportWriter *writer, const uint8_t *data, uint32_t len)
+{
+    writer_putc(writer, '"');
+    json_hex_chunk(writer, data, len);
+    writer_putc(writer, '"');
+}
+
+static void json_string_chunk(SdpExportWriter *writer, const uint8_t *data,
+                              uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++) {
+        uint8_t c = data[i];
+        if (c == '"' || c == '\\') {
+            writer_putc(writer, '\\');
+            writer_putc(writer, c);
+        } else if (c < 0x20) {
+            char escaped[8];
+            sprintf(escaped, "\\u%04x", c);
+            writer_puts(writer, escaped);
+        } else {
+            writer_putc(writer, c);
+        }
+    }
+}
+
+/* MARK: Elements */
+
+/* Reads part of the current element, which need not be contiguous */
+static void element_read(const de_cursor_t *cursor, uint32_t offset,
+                         uint8_t *dest, uint32_t len)
+{
+    if (cursor->store) {
+        sdp_store_read(cursor->store, cursor->pos + offset, dest, len);
+    } else {
+        memcpy(dest, cursor->data + cursor->pos + offset, len);
+    }
+}
+
+/* Checks data a chunk at a time: pending holds the number of continuation
+ * bytes still expected, and must be 0 once all the data has been seen */
+static bool utf8_check(const uint8_t *data, uint32_t len, int *pending)
+{
+    for (uint32_t i = 0; i < len; i++) {
+        uint8_t c = data[i];
+        if (*pending > 0) {
+            if ((c & 0xc0) != 0x80) return false;
+            (*pending)--;
+        } else if (c < 0x80) {
+            continue;
+        } else if ((c & 0xe0) == 0xc0 && c >= 0xc2) {
+            *pending = 1;
+        } else if ((c & 0xf0) == 0xe0) {
+            *pending = 2;
+        } else if ((c & 0xf8) == 0xf0 && c <= 0xf4) {
+            *pending = 3;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void write_uuid(SdpExportWriter *writer, const uint8_t *element)
+{
+    uint8_t uuid[16];
+    if (!de_get_normalized_uuid(uuid, element)) {
+        memset(uuid, 0, sizeof(uuid));
+    }
+
+    if (writer->format == SDP_EXPORT_CBOR) {
+        cbor_head(writer, CBOR_TAG, CBOR_TAG_UUID);
+        cbor_data(writer, CBOR_BYTES, uuid, sizeof(uuid));
+    } else {
+        writer_putc(writer, '"');
+        writer_puts(writer, uuid128_to_str(uuid));
+        writer_putc(writer, '"');
+    }
+}
+
+static void write_number(SdpExportWriter *writer, const uint8_t *element)
+{
+    de_type_t type = de_get_element_type(element);
+    de_size_t size = de_get_size_type(element);
+    const uint8_t *data = element + 1;
+    uint64_t value;
+
+    switch (size) {
+    case DE_SIZE_8: value = data[0]; break;
+    case DE_SIZE_16: value = big_endian_read_16(data, 0); break;
+    case DE_SIZE_32: value = big_endian_read_32(data, 0); break;
+    case DE_SIZE_64:
+        value = ((uint64_t)big_endian_read_32(data, 0) << 32) |
+            big_endian_read_32(data, 4);
+        break;
+    default:
+        /* 128-bit numbers are written as their bytes */
+        if (writer->format == SDP_EXPORT_CBOR) {
+            cbor_data(writer, CBOR_BYTES, data, 16);
+        } else {
+            json_hex(writer, data, 16);
+        }
+        return;
+    }
+
+    bool negative = false;
+    if (type == DE_INT) {
+        /* Sign-extend to 64 bits */
+        int bits = 8 << size;
+        if (bits < 64 && (value >> (bits - 1)) & 1) {
+            value |= ~(uint64_t)0 << bits;
+        }
+        negative = (int64_t)value < 0;
+    }
+
+    if (writer->format == SDP_EXPORT_CBOR) {
+        if (negative) {
+            cbor_head(writer, CBOR_NEGINT, -1 - (int64_t)value);
+        } else {
+            cbor_head(writer, CBOR_UINT, value);
+        }
+    } else {
+        char text[24];
+        if (negative) {
+            sprintf(text, "%lld", (long long)(int64_t)value);
+        } else {
+            sprintf(text, "%llu", (unsigned long long)value);
+        }
+        writer_puts(writer, text);
+    }
+}
+
+/* Strings can be longer than the copy the cursor keeps: they are read from
+ * the data twice, a chunk at a time, once to check them and once to write
+ * them */
+static void write_string(SdpExportWriter *writer, const de_cursor_t *cursor)
+{
+    const uint8_t *element = de_cursor_element(cursor);
+    uint32_t header_size = de_get_header_size(element);
+    uint32_t len = cursor->len - header_size;
+    uint8_t chunk[64];
+
+    bool text = true;
+    int pending = 0;
+    for (uint32_t offset = 0; offset < len && text; offset += sizeof(chunk)) {
+        uint32_t n = len - offset < sizeof(chunk) ? len - offset : sizeof(chunk);
+        element_read(cursor, header_size + offset, chunk, n);
+        text = utf8_check(chunk, n, &pending);
+    }
+    text = text && pending == 0;
+
+    bool cbor = writer->format == SDP_EXPORT_CBOR;
+    if (cbor) {
+        if (de_get_element_type(element) == DE_URL) {
+            cbor_head(writer, CBOR_TAG, CBOR_TAG_URI);
+        }
+        cbor_head(writer, text ? CBOR_TEXT : CBOR_BYTES, len);
+    } else {
+        writer_putc(writer, '"');
+    }
+    for (uint32_t offset = 0; offset < len; offset += sizeof(chunk)) {
+        uint32_t n = len - offset < sizeof(chunk) ? len - offset : sizeof(chunk);
+        element_read(cursor, header_size + offset, chunk, n);
+        if (cbor) writer_put(writer, chunk, n);
+        else if (text) json_string_chunk(writer, chunk, n);
+        else json_hex_chunk(writer, chunk, n);
+    }
+    if (!cbor) writer_putc(writer, '"');
+}
+
+static void write_element(SdpExportWriter *writer, const de_cursor_t *cursor)
+{
+    const uint8_t *element = de_cursor_element(cursor);
+    bool cbor = writer->format == SDP_EXPORT_CBOR;
+
+    switch (de_get_element_type(element)) {
+    case DE_NIL:
+        if (cbor) writer_putc(writer, CBOR_NULL);
+        else writer_puts(writer, "null");
+        break;
+    case DE_BOOL:
+        if (cbor) writer_putc(writer, element[1] ? CBOR_TRUE : CBOR_FALSE);
+        else writer_puts(writer, element[1] ? "true" : "false");
+        break;
+    case DE_UINT:
+    case DE_INT:
+        write_number(writer, element);
+        break;
+    case DE_UUID:
+        write_uuid(writer, element);
+        break;
+    case DE_STRING:
+    case DE_URL:
+        write_string(writer, cursor);
+        break;
+    default:
+        /* Unknown types carry no value we can interpret */
+        if (cbor) writer_putc(writer, CBOR_NULL);
+        else writer_puts(writer, "null");
+        break;
+    }
+}
+
+static void begin_array(SdpExportWriter *writer)
+{
+    if (writer->format == SDP_EXPORT_CBOR) {
+        /* The number of children is not known until they are walked */
+        writer_putc(writer, CBOR_ARRAY | CBOR_INDEFINITE);
+    } else {
+        writer_putc(writer, '[');
+    }
+}
+
+static void end_array(SdpExportWriter *writer)
+{
+    writer_putc(writer, writer->format == SDP_EXPORT_CBOR ? CBOR_BREAK : ']');
+}
+
+bool sdp_export_elements(SdpExportWriter *writer, const SdpStore *store)
+{
+    /* Whether an element has already been written at each depth */
+    bool has_items[DE_CURSOR_MAX_DEPTH + 2] = { false };
+    int open_arrays = 0;
+    bool enter = false;
+    bool trailing = false;
+    de_cursor_t cursor;
+
+    de_cursor_init_store(&cursor, store, 0, store->len);
+    cursor.trusted = store->trusted;
+    while (de_cursor_next(&cursor, enter)) {
+        /* A single value is written: anything after the first root element
+         * is not part of it */
+        if (cursor.depth == 0 && has_items[0]) {
+            trailing = true;
+            break;
+        }
+
+        /* Close the sequences which the cursor has left */
+        while (open_arrays > cursor.depth) {
+            end_array(writer);
+            open_arrays--;
+        }
+
+        if (has_items[cursor.depth] && writer->format == SDP_EXPORT_JSON) {
+            writer_putc(writer, ',');
+        }
+        has_items[cursor.depth] = true;
+
+        const uint8_t *element = de_cursor_element(&cursor);
+        de_type_t type = de_get_element_type(element);
+        enter = type == DE_DES || type == DE_DEA;
+        if (enter) {
+            begin_array(writer);
+            open_arrays++;
+            has_items[open_arrays] = false;
+        } else {
+            write_element(writer, &cursor);
+        }
+    }
+
+    /* Malformed data ends the export, but the output stays well formed */
+    while (open_arrays > 0) {
+        end_array(writer);
+        open_arrays--;
+    }
+    if (!has_items[0]) {
+        if (writer->format == SDP_EXPORT_CBOR) writer_putc(writer, CBOR_NULL);
+        else writer_puts(writer, "null");
+    }
+    return !cursor.error && !trailing && !writer->error;
+}
+
+bool sdp_export_save(const uint8_t *bdaddr, uint16_t uuid,
+                     const SdpStore *response, SdpExportFormat format)
+{
+    if (!sdp_cache_is_available()) return false;
+
+    mkdir(SDP_EXPORT_DIR, 0777);
+
+    char path[64];
+    sprintf(path, SDP_EXPORT_DIR "/%02x%02x%02x%02x%02x%02x-%04x.%s",
+            bdaddr[0], bdaddr[1], bdaddr[2], bdaddr[3], bdaddr[4], bdaddr[5],
+            uuid, format == SDP_EXPORT_CBOR ? "cbor" : "json");
+
+    SdpExportWriter writer = {
+        .file = fopen(path, "wb"),
+        .format = format,
+    };
+    if (!writer.file) return false;
+
+    char address[13];
+    sprintf(address, "%02x%02x%02x%02x%02x%02x",
+            bdaddr[0], bdaddr[1], bdaddr[2], bdaddr[3], bdaddr[4], bdaddr[5]);
+
+    if (format == SDP_EXPORT_CBOR) {
+        cbor_head(&writer, CBOR_MAP, 3);
+        cbor_data(&writer, CBOR_TEXT, "bdaddr", 6);
+        cbor_data(&writer, CBOR_TEXT, address, strlen(address));
+        cbor_data(&writer, CBOR_TEXT, "uuid", 4);
+        cbor_head(&writer, CBOR_UINT, uuid);
+        cbor_data(&writer, CBOR_TEXT, "records", 7);
+    } else {
+        char header[64];
+        sprintf(header, "{\"bdaddr\":\"%s\",\"uuid\":%u,\"records\":",
+                address, uuid);
+        writer_puts(&writer, header);
+    }
+
+    /* What precedes malformed data is still worth having */
+    sdp_export_elements(&writer, response);
+    if (format == SDP_EXPORT_JSON) writer_puts(&writer, "}\n");
+
+    writer_flush(&writer);
+    fclose(writer.file);
+    if (writer.error) remove(path);
+    return !writer.error;
+}
@@ -0,0 +1,46 @@
+#ifndef BTT_SDP_EXPORT_H
+#define BTT_SDP_EXPORT_H
+
+#include "sdp_store.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * Writes SDP data elements to a file as they are walked, through a small
+ * fixed buffer. Sequences and alternatives become arrays, UUIDs are written
+ * in their 128-bit form, and strings which are not valid UTF-8 (such as HID
+ * report descriptors) are written as bytes: hex strings in JSON, byte
+ * strings in CBOR.
+ */
+
+typedef enum {
+    SDP_EXPORT_JSON = 0,
+    SDP_EXPORT_CBOR,
+} SdpExportFormat;
+
+#define SDP_EXPORT_BUFFER_SIZE 256
+
+typedef struct {
+    FILE *file;
+    SdpExportFormat format;
+    uint8_t buffer[SDP_EXPORT_BUFFER_SIZE];
+    int len;
+    bool error;
+} SdpExportWriter;
+
+/* Writes the first element in store, walking it by offset; it is not
+ * checked if the store is trusted. Returns false if it is malformed, if
+ * more data follows it, or on write errors. */
+bool sdp_export_elements(SdpExportWriter *writer, const SdpStore *store);
+
+/*
+ * Saves a response as an object holding the device address, the UUID which
+ * was searched for and the records. The file goes next to the SDP cache,
+ * which must have been initialized. Returns false on write errors.
+ */
+bool sdp_export_save(const uint8_t *bdaddr, uint16_t uuid,
+                     const SdpStore *response, SdpExportFormat format);
+
+#endif // BTT_SDP_EXPORT_H
@@ -0,0 +1,241 @@
+#include "sdp_record.h"
+
+#include "bluetooth_sdp.h"
+#include "btstack_util.h"
+#include "sdp_util.h"
+
+#include <string.h>
+
+/* Reads booleans and unsigned integers of up to 32 bits */
+static bool sdp_element_get_uint(const uint8_t *element, uint32_t *value)
+{
+    de_type_t type = de_get_element_type(element);
+    if (type != DE_UINT && type != DE_BOOL) return false;
+
+    switch (de_get_size_type(element)) {
+    case DE_SIZE_8:
+        *value = element[1];
+        return true;
+    case DE_SIZE_16:
+        *value = big_endian_read_16(element, 1);
+        return true;
+    case DE_SIZE_32:
+        *value = big_endian_read_32(element, 1);
+        return true;
+    default:
+        return false;
+    }
+}
+
+static void sdp_record_set_value(SdpRecordInfo *info, uint16_t attribute,
+                                 const uint8_t *element)
+{
+    uint32_t value;
+    if (!sdp_element_get_uint(element, &value)) return;
+
+    if (attribute == BLUETOOTH_ATTRIBUTE_SERVICE_RECORD_HANDLE) {
+        info->handle = value;
+    } else if (info->is_hid) {
+        SdpHidInfo *hid = &info->hid;
+        switch (attribute) {
+        case BLUETOOTH_ATTRIBUTE_HID_DEVICE_RELEASE_NUMBER:
+            hid->release_number = value; break;
+        case BLUETOOTH_ATTRIBUTE_HID_PARSER_VERSION:
+            hid->parser_version = value; break;
+        case BLUETOOTH_ATTRIBUTE_HID_DEVICE_SUBCLASS:
+            hid->subclass = value; break;
+        case BLUETOOTH_ATTRIBUTE_HID_COUNTRY_CODE:
+            hid->country_code = value; break;
+        case BLUETOOTH_ATTRIBUTE_HID_VIRTUAL_CABLE:
+            hid->virtual_cable = value; break;
+        case BLUETOOTH_ATTRIBUTE_HID_RECONNECT_INITIATE:
+            hid->reconnect_initiate = value; break;
+        case BLUETOOTH_ATTRIBUTE_HID_BATTERY_POWER:
+            hid->battery_power = value; break;
+        case BLUETOOTH_ATTRIBUTE_HID_REMOTE_WAKE:
+            hid->remote_wake = value; break;
+        case BLUETOOTH_ATTRIBUTE_HID_PROFILE_VERSION:
+            hid->profile_version = value; break;
+        case BLUETOOTH_ATTRIBUTE_HID_SUPERVISION_TIMEOUT:
+            hid->supervision_timeout = value; break;
+        case BLUETOOTH_ATTRIBUTE_HID_NORMALLY_CONNECTABLE:
+            hid->normally_connectable = value; break;
+        case BLUETOOTH_ATTRIBUTE_HID_BOOT_DEVICE:
+            hid->boot_device = value; break;
+        }
+    } else if (info->is_pnp) {
+        SdpPnpInfo *pnp = &info->pnp;
+        switch (attribute) {
+        case BLUETOOTH_ATTRIBUTE_SPECIFICATION_ID:
+            pnp->specification_id = value; break;
+        case BLUETOOTH_ATTRIBUTE_VENDOR_ID:
+            pnp->vendor_id = value; break;
+        case BLUETOOTH_ATTRIBUTE_PRODUCT_ID:
+            pnp->product_id = value; break;
+        case BLUETOOTH_ATTRIBUTE_VERSION:
+            pnp->version = value; break;
+        case BLUETOOTH_ATTRIBUTE_PRIMARY_RECORD:
+            pnp->primary_record = value; break;
+        case BLUETOOTH_ATTRIBUTE_VENDOR_ID_SOURCE:
+            pnp->vendor_id_source = value; break;
+        }
+    }
+}
+
+/* Whether the elements of the value of attribute are of interest */
+static bool sdp_record_wants_sequence(const SdpRecordInfo *info,
+                                      uint16_t attribute)
+{
+    switch (attribute) {
+    case BLUETOOTH_ATTRIBUTE_SERVICE_CLASS_ID_LIST:
+    case BLUETOOTH_ATTRIBUTE_PROTOCOL_DESCRIPTOR_LIST:
+    case BLUETOOTH_ATTRIBUTE_BLUETOOTH_PROFILE_DESCRIPTOR_LIST:
+        return true;
+    case BLUETOOTH_ATTRIBUTE_HID_DESCRIPTOR_LIST:
+        return info->is_hid;
+    default:
+        return false;
+    }
+}
+
+/*
+ * Handles an element nested in the value of attribute: depth 2 is an item
+ * of the list, depth 3 is the index-th field of such item, and first is the
+ * value of the item's first field. Returns true if the element is a
+ * sequence which must be entered.
+ */
+static bool sdp_record_set_item(SdpRecordInfo *info, uint16_t attribute,
+                                const uint8_t *element, int depth, int index,
+                                uint32_t first, uint32_t offset)
+{
+    de_type_t type = de_get_element_type(element);
+
+    if (attribute == BLUETOOTH_ATTRIBUTE_SERVICE_CLASS_ID_LIST) {
+        if (depth != 2 || type != DE_UUID) return false;
+        uint32_t uuid = de_get_uuid32(element);
+        if (uuid == BLUETOOTH_SERVICE_CLASS_HUMAN_INTERFACE_DEVICE_SERVICE) {
+            info->is_hid = true;
+        } else if (uuid == BLUETOOTH_SERVICE_CLASS_PNP_INFORMATION) {
+            info->is_pnp = true;
+        }
+        if (info->num_classes < SDP_RECORD_MAX_CLASSES) {
+            info->classes[info->num_classes++] = uuid;
+        }
+        return false;
+    }
+
+    if (depth == 2) {
+        /* Each item is a sequence of fields */
+        return type == DE_DES;
+    }
+    if (depth != 3) return false;
+
+    uint32_t value;
+    if (attribute == BLUETOOTH_ATTRIBUTE_PROTOCOL_DESCRIPTOR_LIST) {
+        if (index == 0 && type == DE_UUID) {
+            if (info->num_protocols >= SDP_RECORD_MAX_PROTOCOLS) return false;
+            SdpProtocol *protocol = &info->protocols[info->num_protocols++];
+            protocol->uuid = de_get_uuid32(element);
+            protocol->has_param = false;
+        } else if (index == 1 && info->num_protocols > 0 &&
+                   sdp_element_get_uint(element, &value)) {
+            SdpProtocol *protocol = &info->protocols[info->num_protocols - 1];
+            protocol->has_param = true;
+            protocol->param = value;
+        }
+    } else if (attribute == BLUETOOTH_ATTRIBUTE_BLUETOOTH_PROFILE_DESCRIPTOR_LIST) {
+        if (index == 0 && type == DE_UUID) {
+            if (info->num_profiles >= SDP_RECORD_MAX_PROFILES) return false;
+            SdpProfileVersion *profile = &info->profiles[info->num_profiles++];
+            profile->uuid = de_get_uuid32(element);
+            profile->version = 0;
+        } else if (index == 1 && info->num_profiles > 0 &&
+                   sdp_element_get_uint(element, &value)) {
+            info->profiles[info->num_profiles - 1].version = value;
+        }
+    } else if (attribute == BLUETOOTH_ATTRIBUTE_HID_DESCRIPTOR_LIST) {
+        /* Pairs of descriptor type and descriptor data */
+        if (index == 1 && first == 0x22 && type == DE_STRING &&
+            info->hid.report_descriptor_len == 0) {
+            uint32_t header_size = de_get_header_size(element);
+            info->hid.report_descriptor_offset = offset + header_size;
+            info->hid.report_descriptor_len = de_get_len(element) - header_size;
+        }
+    }
+    return false;
+}
+
+/* Walks the attribute list the cursor has been set up on; offsets are
+ * those of the cursor */
+static bool sdp_record_walk(de_cursor_t *cursor, SdpRecordInfo *info)
+{
+    memset(info, 0, sizeof(*info));
+
+    if (!de_cursor_next(cursor, false) ||
+        de_get_element_type(de_cursor_element(cursor)) != DE_DES) return false;
+
+    bool enter = true;
+    int pair_index = 0;
+    int field_index = 0;
+    uint32_t first_field = 0;
+    uint16_t attribute = 0;
+    while (de_cursor_next(cursor, enter)) {
+        const uint8_t *element = de_cursor_element(cursor);
+        int depth = cursor->depth;
+        enter = false;
+
+        if (depth == 1) {
+            if (pair_index++ % 2 == 0) {
+                /* Attributes we cannot read are skipped with their value */
+                if (!de_element_get_uint16(element, &attribute)) attribute = 0xffff;
+                continue;
+            }
+            if (de_get_element_type(element) == DE_DES) {
+                enter = sdp_record_wants_sequence(info, attribute);
+            } else {
+                sdp_record_set_value(info, attribute, element);
+            }
+        } else {
+            if (depth == 2) field_index = 0;
+            if (depth == 3 && field_index == 0 &&
+                !sdp_element_get_uint(element, &first_field)) first_field = 0;
+            enter = sdp_record_set_item(info, attribute, element, depth,
+                                        field_index, first_field, cursor->pos);
+            if (depth == 3) field_index++;
+        }
+    }
+    return !cursor->error;
+}
+
+bool sdp_record_extract(const uint8_t *record, uint32_t size,
+                        SdpRecordInfo *info)
+{
+    de_cursor_t cursor;
+    de_cursor_init(&cursor, record, size);
+    return sdp_record_walk(&cursor, info);
+}
+
+int sdp_records_extract(const SdpStore *response, bool trusted,
+                        SdpRecordInfo *records, int max_records)
+{
+    de_cursor_t cursor;
+    de_cursor_init_store(&cursor, response, 0, response->len);
+    cursor.trusted = trusted;
+    if (!de_cursor_next(&cursor, false) ||
+        de_get_element_type(de_cursor_element(&cursor)) != DE_DES) return -1;
+
+    int num_records = 0;
+    bool enter = true;
+    while (de_cursor_next(&cursor, enter)) {
+        enter = false;
+        if (num_records < max_records) {
+            /* Each record gets a cursor of its own over the same store */
+            de_cursor_t record;
+            de_cursor_init_store(&record, response, cursor.pos, cursor.len);
+            record.trusted = trusted;
+            if (!sdp_record_walk(&record, &records[num_records])) return -1;
+        }
+        num_records++;
+    }
+    return cursor.error ? -1 : num_records;
+}
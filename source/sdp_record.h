@@ -0,0 +1,89 @@
+#ifndef BTT_SDP_RECORD_H
+#define BTT_SDP_RECORD_H
+
+#include "sdp_store.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * The attributes of an SDP record which the tool acts upon, extracted in a
+ * single walk over the record. Anything which does not fit in the arrays
+ * below is dropped.
+ */
+
+#define SDP_RECORD_MAX_CLASSES 4
+#define SDP_RECORD_MAX_PROTOCOLS 4
+#define SDP_RECORD_MAX_PROFILES 4
+
+typedef struct {
+    uint32_t uuid;
+    /* PSM for L2CAP, channel for RFCOMM and so on */
+    bool has_param;
+    uint16_t param;
+} SdpProtocol;
+
+typedef struct {
+    uint32_t uuid;
+    uint16_t version;
+} SdpProfileVersion;
+
+typedef struct {
+    uint16_t release_number;
+    uint16_t parser_version;
+    uint8_t subclass;
+    uint8_t country_code;
+    bool virtual_cable;
+    bool reconnect_initiate;
+    bool battery_power;
+    bool remote_wake;
+    bool normally_connectable;
+    bool boot_device;
+    uint16_t profile_version;
+    uint16_t supervision_timeout;
+    /* The first report descriptor, as an offset into the data which has
+     * been passed to the extractor; its length is 0 if there is none */
+    uint32_t report_descriptor_offset;
+    uint16_t report_descriptor_len;
+} SdpHidInfo;
+
+typedef struct {
+    uint16_t specification_id;
+    uint16_t vendor_id;
+    uint16_t product_id;
+    uint16_t version;
+    bool primary_record;
+    uint16_t vendor_id_source;
+} SdpPnpInfo;
+
+typedef struct {
+    uint32_t handle;
+    uint32_t classes[SDP_RECORD_MAX_CLASSES];
+    int num_classes;
+    SdpProtocol protocols[SDP_RECORD_MAX_PROTOCOLS];
+    int num_protocols;
+    SdpProfileVersion profiles[SDP_RECORD_MAX_PROFILES];
+    int num_profiles;
+    /* The attributes in the 0x0200 range are read according to the service
+     * class, which comes first in the record */
+    bool is_hid;
+    SdpHidInfo hid;
+    bool is_pnp;
+    SdpPnpInfo pnp;
+} SdpRecordInfo;
+
+/* Fills info from an attribute list; returns false if it is malformed */
+bool sdp_record_extract(const uint8_t *record, uint32_t size,
+                        SdpRecordInfo *info);
+/*
+ * Same as above, for a sequence of attribute lists such as the response to
+ * a ServiceSearchAttribute request. The store is walked by offset, so the
+ * offsets in the records are offsets in the store. Returns the number of
+ * records found, which may be more than max_records, or -1 if the data is
+ * malformed. Set trusted if the data has already been validated, to skip
+ * the checks.
+ */
+int sdp_records_extract(const SdpStore *response, bool trusted,
+                        SdpRecordInfo *records, int max_records);
+
+#endif // BTT_SDP_RECORD_H
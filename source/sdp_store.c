@@ -0,0 +1,100 @@
+#include "sdp_store.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+bool sdp_store_append(SdpStore *store, const void *data, uint32_t len)
+{
+    const uint8_t *src = data;
+
+    if (len > 0) store->trusted = false;
+    while (len > 0) {
+        int block = store->len / SDP_STORE_BLOCK_SIZE;
+        uint32_t offset = store->len % SDP_STORE_BLOCK_SIZE;
+        if (block >= SDP_STORE_MAX_BLOCKS) return false;
+
+        if (!store->blocks[block]) {
+            store->blocks[block] = malloc(SDP_STORE_BLOCK_SIZE);
+            if (!store->blocks[block]) return false;
+        }
+
+        uint32_t chunk = SDP_STORE_BLOCK_SIZE - offset;
+        if (chunk > len) chunk = len;
+        memcpy(store->blocks[block] + offset, src, chunk);
+        /* Readers only look at data below len */
+        store->len += chunk;
+        src += chunk;
+        len -= chunk;
+    }
+    return true;
+}
+
+void sdp_store_reset(SdpStore *store)
+{
+    store->len = 0;
+    store->trusted = false;
+}
+
+void sdp_store_clear(SdpStore *store)
+{
+    for (int i = 0; i < SDP_STORE_MAX_BLOCKS; i++) {
+        free(store->blocks[i]);
+    }
+    free(store->scratch);
+    memset(store, 0, sizeof(*store));
+}
+
+uint32_t sdp_store_read(const SdpStore *store, uint32_t offset,
+                        void *dest, uint32_t len)
+{
+    uint8_t *dst = dest;
+
+    if (offset >= store->len) return 0;
+    if (len > store->len - offset) len = store->len - offset;
+
+    uint32_t copied = 0;
+    while (copied < len) {
+        int block = offset / SDP_STORE_BLOCK_SIZE;
+        uint32_t block_offset = offset % SDP_STORE_BLOCK_SIZE;
+        uint32_t chunk = SDP_STORE_BLOCK_SIZE - block_offset;
+        if (chunk > len - copied) chunk = len - copied;
+        memcpy(dst + copied, store->blocks[block] + block_offset, chunk);
+        offset += chunk;
+        copied += chunk;
+    }
+    return copied;
+}
+
+const uint8_t *sdp_store_get(SdpStore *store, uint32_t offset, uint32_t len)
+{
+    /* Even with len 0, the block of offset is looked up */
+    if (offset >= store->len || len > store->len - offset) return NULL;
+
+    uint32_t block_offset = offset % SDP_STORE_BLOCK_SIZE;
+    if (block_offset + len <= SDP_STORE_BLOCK_SIZE) {
+        return store->blocks[offset / SDP_STORE_BLOCK_SIZE] + block_offset;
+    }
+
+    if (len > store->scratch_size) {
+        uint8_t *scratch = realloc(store->scratch, len);
+        if (!scratch) return NULL;
+        store->scratch = scratch;
+        store->scratch_size = len;
+    }
+    sdp_store_read(store, offset, store->scratch, len);
+    return store->scratch;
+}
+
+bool sdp_store_equal(const SdpStore *a, const SdpStore *b)
+{
+    if (a->len != b->len) return false;
+
+    /* Both stores use the same block size */
+    for (uint32_t offset = 0; offset < a->len; offset += SDP_STORE_BLOCK_SIZE) {
+        int block = offset / SDP_STORE_BLOCK_SIZE;
+        uint32_t chunk = a->len - offset;
+        if (chunk > SDP_STORE_BLOCK_SIZE) chunk = SDP_STORE_BLOCK_SIZE;
+        if (memcmp(a->blocks[block], b->blocks[block], chunk) != 0) return false;
+    }
+    return true;
+}
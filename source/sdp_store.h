@@ -0,0 +1,50 @@
+#ifndef BTT_SDP_STORE_H
+#define BTT_SDP_STORE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* MaximumAttributeByteCount only limits each response PDU, not the whole
+ * response put together from the continuations: this cap is arbitrary, and
+ * what does not fit is dropped (the SDP client reports it as
+ * SDP_CLIENT_ERROR_NO_SPACE) */
+#define SDP_STORE_BLOCK_SIZE 1024
+#define SDP_STORE_MAX_BLOCKS 64
+#define SDP_STORE_MAX_SIZE (SDP_STORE_BLOCK_SIZE * SDP_STORE_MAX_BLOCKS)
+
+/*
+ * Bytes of an SDP response, held in fixed-size blocks which are allocated as
+ * the response grows. Blocks are never moved, so data which has been
+ * appended stays where it is while more fragments arrive.
+ */
+typedef struct {
+    uint8_t *blocks[SDP_STORE_MAX_BLOCKS];
+    uint32_t len;
+    /* Holds the elements which cross a block boundary */
+    uint8_t *scratch;
+    uint32_t scratch_size;
+    /* Set by de_validate_store() once all the data has been checked to be
+     * well formed; cleared whenever the data changes */
+    bool trusted;
+} SdpStore;
+
+/* Returns false if the data did not fit; as much as possible is stored */
+bool sdp_store_append(SdpStore *store, const void *data, uint32_t len);
+/* Forgets the data, but keeps the blocks for the next response */
+void sdp_store_reset(SdpStore *store);
+void sdp_store_clear(SdpStore *store);
+
+/* Returns the number of bytes copied */
+uint32_t sdp_store_read(const SdpStore *store, uint32_t offset,
+                        void *dest, uint32_t len);
+/*
+ * Returns len contiguous bytes starting at offset: they point into the
+ * store if they lie in a single block, otherwise they are a copy which is
+ * valid until the next call. Returns NULL if the bytes are not available,
+ * or if offset is not within the data.
+ */
+const uint8_t *sdp_store_get(SdpStore *store, uint32_t offset, uint32_t len);
+
+bool sdp_store_equal(const SdpStore *a, const SdpStore *b);
+
+#endif // BTT_SDP_STORE_H
@@ -54,6 +54,7 @@
 #include <inttypes.h>   // PRIx32
 
 #ifdef ENABLE_SDP_DES_DUMP
+#include <stdarg.h>
 #include <stdio.h>
 #endif
 
@@ -319,19 +320,131 @@ void des_iterator_next(des_iterator_t * it){
     it->pos += element_len;
 }
 
+// MARK: DES cursor
+void de_cursor_init(de_cursor_t * cursor, const uint8_t * data, uint32_t size){
+    memset(cursor, 0, sizeof(*cursor));
+    cursor->data = data;
+    cursor->end[0] = size;
+}
+
+void de_cursor_init_trusted(de_cursor_t * cursor, const uint8_t * data, uint32_t size){
+    de_cursor_init(cursor, data, size);
+    cursor->trusted = true;
+}
+
+void de_cursor_init_store(de_cursor_t * cursor, const SdpStore * store, uint32_t offset, uint32_t size){
+    de_cursor_init(cursor, NULL, offset + size);
+    cursor->store = store;
+    cursor->pos = offset;
+}
+
+// the current element, copied if it is in a store; end bounds the copy
+static const uint8_t * de_cursor_fetch(de_cursor_t * cursor, uint32_t end){
+    if (!cursor->store) return &cursor->data[cursor->pos];
+    uint32_t len = end - cursor->pos;
+    if (len > sizeof(cursor->element)) len = sizeof(cursor->element);
+    sdp_store_read(cursor->store, cursor->pos, cursor->element, len);
+    return cursor->element;
+}
+
+bool de_cursor_next(de_cursor_t * cursor, bool enter){
+    if (cursor->error) return false;
+    if (cursor->started){
+        if (cursor->len == 0) return false; // already at the end
+        const uint8_t * element = de_cursor_element(cursor);
+        de_type_t type = de_get_element_type(element);
+        if (enter && (type == DE_DES || type == DE_DEA)){
+            if (cursor->depth >= DE_CURSOR_MAX_DEPTH){
+                cursor->error = true;
+                return false;
+            }
+            cursor->depth++;
+            cursor->end[cursor->depth] = cursor->pos + cursor->len;
+            if (cursor->truncated){
+                cursor->truncated_levels |= 1u << cursor->depth;
+            }
+            cursor->pos += de_get_header_size(element);
+        } else if (cursor->truncated){
+            // skipping it would hide the missing data
+            cursor->error = true;
+            return false;
+        } else {
+            cursor->pos += cursor->len;
+        }
+        cursor->truncated = false;
+        // leave all sequences which have been completed
+        while (cursor->depth > 0 && cursor->pos >= cursor->end[cursor->depth]){
+            if (cursor->truncated_levels & (1u << cursor->depth)){
+                cursor->error = true;
+                return false;
+            }
+            cursor->depth--;
+        }
+    }
+    cursor->started = true;
+    cursor->len = 0;
+    uint32_t end = cursor->end[cursor->depth];
+    if (cursor->pos >= end) return false;
+    const uint8_t * element = de_cursor_fetch(cursor, end);
+    if (cursor->trusted){
+        cursor->len = de_get_len(element);
+        return true;
+    }
+    cursor->len = de_get_len_safe(element, end - cursor->pos);
+    if (cursor->len == 0){
+        // a sequence which has been cut short can still be entered, so that
+        // the elements before the cut are reachable
+        de_type_t type = de_get_element_type(element);
+        if ((type == DE_DES || type == DE_DEA) &&
+            de_get_header_size(element) <= end - cursor->pos){
+            cursor->len = end - cursor->pos;
+            cursor->truncated = true;
+            return true;
+        }
+        cursor->error = true;
+        return false;
+    }
+    return true;
+}
+
+const uint8_t * de_cursor_element(const de_cursor_t * cursor){
+    if (cursor->store) return cursor->element;
+    return &cursor->data[cursor->pos];
+}
+
+bool de_validate(const uint8_t * data, uint32_t size, uint32_t * error_offset){
+    de_cursor_t cursor;
+    de_cursor_init(&cursor, data, size);
+    while (de_cursor_next(&cursor, true)) {}
+    if (error_offset) *error_offset = cursor.pos;
+    return !cursor.error && size > 0;
+}
+
+bool de_validate_store(SdpStore * store){
+    if (store->trusted) return true;
+    // only the headers are looked at, so nothing needs to be contiguous
+    de_cursor_t cursor;
+    de_cursor_init_store(&cursor, store, 0, store->len);
+    while (de_cursor_next(&cursor, true)) {}
+    store->trusted = !cursor.error && store->len > 0;
+    return store->trusted;
+}
+
 // MARK: DataElementSequence traversal
 typedef int (*de_traversal_callback_t)(const uint8_t * element, de_type_t type, de_size_t size, void *context);
 static void de_traverse_sequence(const uint8_t * element, de_traversal_callback_t handler, void *context){
     de_type_t type = de_get_element_type(element);
     if (type != DE_DES) return;
-    int pos = de_get_header_size(element);
-    int end_pos = de_get_len(element);
-    while (pos < end_pos){
-        de_type_t elemType = de_get_element_type(element + pos);
-        de_size_t elemSize = de_get_size_type(element + pos);
-        uint8_t done = (*handler)(element + pos, elemType, elemSize, context); 
+    de_cursor_t cursor;
+    de_cursor_init(&cursor, element, de_get_len(element));
+    de_cursor_next(&cursor, false);
+    // enter the sequence itself, then only step over its children
+    while (de_cursor_next(&cursor, cursor.depth == 0)){
+        const uint8_t * child = de_cursor_element(&cursor);
+        de_type_t elemType = de_get_element_type(child);
+        de_size_t elemSize = de_get_size_type(child);
+        uint8_t done = (*handler)(child, elemType, elemSize, context); 
         if (done) break;
-        pos += de_get_len(element + pos);
     }
 }
 
@@ -340,20 +453,21 @@ typedef int (*sdp_attribute_list_traversal_callback_t)(uint16_t attributeID, con
 static void sdp_attribute_list_traverse_sequence(const uint8_t * element, sdp_attribute_list_traversal_callback_t handler, void *context){
     de_type_t type = de_get_element_type(element);
     if (type != DE_DES) return;
-    int pos = de_get_header_size(element);
-    int end_pos = de_get_len(element);
-    while (pos < end_pos){
-        de_type_t idType = de_get_element_type(element + pos);
-        de_size_t idSize = de_get_size_type(element + pos);
+    de_cursor_t cursor;
+    de_cursor_init(&cursor, element, de_get_len(element));
+    de_cursor_next(&cursor, false);
+    while (de_cursor_next(&cursor, cursor.depth == 0)){
+        const uint8_t * id = de_cursor_element(&cursor);
+        de_type_t idType = de_get_element_type(id);
+        de_size_t idSize = de_get_size_type(id);
         if ( (idType != DE_UINT) || (idSize != DE_SIZE_16) ) break; // wrong type
-        uint16_t attribute_id = big_endian_read_16(element, pos + 1);
-        pos += 3;
-        if (pos >= end_pos) break; // array out of bounds
-        de_type_t valueType = de_get_element_type(element + pos);
-        de_size_t valueSize = de_get_size_type(element + pos);
-        uint8_t done = (*handler)(attribute_id, element + pos, valueType, valueSize, context); 
+        uint16_t attribute_id = big_endian_read_16(id, 1);
+        if (!de_cursor_next(&cursor, false)) break; // array out of bounds
+        const uint8_t * value = de_cursor_element(&cursor);
+        de_type_t valueType = de_get_element_type(value);
+        de_size_t valueSize = de_get_size_type(value);
+        uint8_t done = (*handler)(attribute_id, value, valueType, valueSize, context); 
         if (done) break;
-        pos += de_get_len(element + pos);
     }
 }
 
@@ -658,65 +772,148 @@ bool sdp_set_attribute_value_for_attribute_id(uint8_t * record, uint16_t attribu
     return context.attributeFound;
 }
 
-// MARK: ServiceRecord contains UUID
-// service record contains UUID
-// context { normalizedUUID }
-struct sdp_context_contains_uuid128 {
-    const uint8_t * uuid128;
-    int result;
-};
-int sdp_record_contains_UUID128(const uint8_t *record, const uint8_t *uuid128);
-static int sdp_traversal_contains_UUID128(const uint8_t * element, de_type_t type, de_size_t de_size, void *my_context){
-    UNUSED(de_size);
+// MARK: UUID interning
+// last 8 bytes of the Bluetooth Base UUID, 00000000-0000-1000-8000-00805F9B34FB
+static const uint8_t sdp_bluetooth_base_uuid_low[] = { 0x80, 0x00, 0x00, 0x80, 0x5F, 0x9B, 0x34, 0xFB };
 
-    struct sdp_context_contains_uuid128 * context = (struct sdp_context_contains_uuid128 *) my_context;
-    uint8_t normalizedUUID[16];
-    if (type == DE_UUID){
-        uint8_t uuidOK = de_get_normalized_uuid(normalizedUUID, element);
-        context->result = uuidOK && (memcmp(context->uuid128, normalizedUUID, 16) == 0);
+void sdp_uuid_from_uuid128(sdp_uuid_t *uuid, const uint8_t *uuid128){
+    uint64_t base_low;
+    (void)memcpy(&base_low, sdp_bluetooth_base_uuid_low, 8);
+    // the words are only ever compared for equality, so byte order does not matter
+    (void)memcpy(uuid->words, uuid128, 16);
+    uuid->uuid32 = big_endian_read_32(uuid128, 0);
+    uuid->is_uuid32 = (uuid->words[1] == base_low) && (big_endian_read_32(uuid128, 4) == 0x00001000);
+}
+
+bool de_get_compact_uuid(const uint8_t *element, sdp_uuid_t *uuid){
+    if (de_get_element_type(element) != DE_UUID) return false;
+    switch (de_get_size_type(element)){
+        case DE_SIZE_16:
+            uuid->is_uuid32 = true;
+            uuid->uuid32 = big_endian_read_16(element, 1);
+            return true;
+        case DE_SIZE_32:
+            uuid->is_uuid32 = true;
+            uuid->uuid32 = big_endian_read_32(element, 1);
+            return true;
+        case DE_SIZE_128:
+            sdp_uuid_from_uuid128(uuid, element + 1);
+            return true;
+        default:
+            return false;
     }
-    if (type == DE_DES){
-        context->result = sdp_record_contains_UUID128(element, context->uuid128);
+}
+
+void sdp_uuid_table_init(sdp_uuid_table_t *table){
+    table->num_uuid32s = 0;
+    table->num_uuid128s = 0;
+    table->num_ids = 0;
+}
+
+int sdp_uuid_table_lookup(const sdp_uuid_table_t *table, const sdp_uuid_t *uuid){
+    if (uuid->is_uuid32){
+        for (int i = 0; i < table->num_uuid32s; i++){
+            if (table->uuid32s[i] == uuid->uuid32) return table->uuid32_ids[i];
+        }
+    } else {
+        for (int i = 0; i < table->num_uuid128s; i++){
+            if (table->uuid128s[i][0] == uuid->words[0] &&
+                table->uuid128s[i][1] == uuid->words[1]) return table->uuid128_ids[i];
+        }
     }
-    return context->result;
+    return -1;
 }
-int sdp_record_contains_UUID128(const uint8_t *record, const uint8_t *uuid128){
-    struct sdp_context_contains_uuid128 context;
-    context.uuid128 = uuid128;
-    context.result = 0;
-    de_traverse_sequence(record, sdp_traversal_contains_UUID128, &context);
-    return context.result;
+
+int sdp_uuid_table_intern(sdp_uuid_table_t *table, const sdp_uuid_t *uuid){
+    int id = sdp_uuid_table_lookup(table, uuid);
+    if (id >= 0) return id;
+    if (table->num_ids >= SDP_UUID_TABLE_MAX_UUIDS) return -1;
+
+    id = table->num_ids++;
+    if (uuid->is_uuid32){
+        table->uuid32s[table->num_uuid32s] = uuid->uuid32;
+        table->uuid32_ids[table->num_uuid32s++] = id;
+    } else {
+        table->uuid128s[table->num_uuid128s][0] = uuid->words[0];
+        table->uuid128s[table->num_uuid128s][1] = uuid->words[1];
+        table->uuid128_ids[table->num_uuid128s++] = id;
+    }
+    return id;
 }
-    
-// MARK: ServiceRecord matches SearchServicePattern
-// if UUID in searchServicePattern is not found in record => false
-// context { result, record }
-struct sdp_context_match_pattern {
-    const uint8_t * record;
+
+struct sdp_context_intern_pattern {
+    sdp_uuid_table_t * table;
     bool result;
 };
 
-static int sdp_traversal_match_pattern(const uint8_t * element, de_type_t de_type, de_size_t de_size, void *my_context){
+static int sdp_traversal_intern_pattern(const uint8_t * element, de_type_t de_type, de_size_t de_size, void *my_context){
     UNUSED(de_type);
     UNUSED(de_size);
-    
-    struct sdp_context_match_pattern * context = (struct sdp_context_match_pattern *) my_context;
-    uint8_t normalizedUUID[16];
-    uint8_t uuidOK = de_get_normalized_uuid(normalizedUUID, element);
-    if (!uuidOK || !sdp_record_contains_UUID128(context->record, normalizedUUID)){
+
+    struct sdp_context_intern_pattern * context = (struct sdp_context_intern_pattern *) my_context;
+    sdp_uuid_t uuid;
+    if (!de_get_compact_uuid(element, &uuid) || sdp_uuid_table_intern(context->table, &uuid) < 0){
         context->result = false;
         return 1;
     }
     return 0;
 }
-bool sdp_record_matches_service_search_pattern(const uint8_t *record, const uint8_t *serviceSearchPattern){
-    struct sdp_context_match_pattern context;
-    context.record = record;
+
+bool sdp_uuid_table_intern_pattern(sdp_uuid_table_t *table, const uint8_t *serviceSearchPattern){
+    struct sdp_context_intern_pattern context;
+    context.table = table;
     context.result = true;
-    de_traverse_sequence(serviceSearchPattern, sdp_traversal_match_pattern, &context);
+    de_traverse_sequence(serviceSearchPattern, sdp_traversal_intern_pattern, &context);
     return context.result;
 }
 
+static uint32_t sdp_uuid_table_all_ids(const sdp_uuid_table_t *table){
+    if (table->num_ids >= 32) return 0xffffffffu;
+    return (1u << table->num_ids) - 1u;
+}
+
+// MARK: ServiceRecord contains UUID
+// service record contains UUID, at any nesting level
+uint32_t sdp_record_find_uuids(const uint8_t *record, const sdp_uuid_table_t *table){
+    if (de_get_element_type(record) != DE_DES) return 0;
+    uint32_t all_ids = sdp_uuid_table_all_ids(table);
+    uint32_t found = 0;
+    de_cursor_t cursor;
+    de_cursor_init(&cursor, record, de_get_len(record));
+    de_cursor_next(&cursor, false);
+    bool enter = true;
+    while (found != all_ids && de_cursor_next(&cursor, enter)){
+        const uint8_t * element = de_cursor_element(&cursor);
+        de_type_t type = de_get_element_type(element);
+        sdp_uuid_t uuid;
+        if (type == DE_UUID && de_get_compact_uuid(element, &uuid)){
+            int id = sdp_uuid_table_lookup(table, &uuid);
+            if (id >= 0) found |= 1u << id;
+        }
+        enter = type == DE_DES;
+    }
+    return found;
+}
+
+int sdp_record_contains_UUID128(const uint8_t *record, const uint8_t *uuid128){
+    sdp_uuid_table_t table;
+    sdp_uuid_t uuid;
+    sdp_uuid_table_init(&table);
+    sdp_uuid_from_uuid128(&uuid, uuid128);
+    sdp_uuid_table_intern(&table, &uuid);
+    return sdp_record_find_uuids(record, &table) != 0;
+}
+    
+// MARK: ServiceRecord matches SearchServicePattern
+// if UUID in searchServicePattern is not found in record => false
+bool sdp_record_matches_service_search_pattern(const uint8_t *record, const uint8_t *serviceSearchPattern){
+    sdp_uuid_table_t table;
+    sdp_uuid_table_init(&table);
+    if (!sdp_uuid_table_intern_pattern(&table, serviceSearchPattern)) return false;
+    if (table.num_ids == 0) return true;
+    return sdp_record_find_uuids(record, &table) == sdp_uuid_table_all_ids(&table);
+}
+
 // MARK: Dump DataElement
 // context { indent }
 #ifdef ENABLE_SDP_DES_DUMP
@@ -726,20 +923,34 @@ static inline bool vis() {
         s_dump_row < (s_dump_from_row + s_dump_max_rows);
 }
 
-static int de_traversal_dump_data(const uint8_t * element, de_type_t de_type, de_size_t de_size, void *my_context){
-    unsigned int indent = *(int*) my_context;
+static SdpLineCache *s_line_cache = NULL;
+
+static void sdp_line_cache_append(SdpLineCache *cache, const char *format,
+                                  va_list args);
+
+static void sdp_printf(const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    if (s_line_cache) {
+        sdp_line_cache_append(s_line_cache, format, args);
+    } else {
+        vprintf(format, args);
+    }
+    va_end(args);
+}
+
+static void de_dump_row(const uint8_t * element, de_type_t de_type, de_size_t de_size, unsigned int indent){
     unsigned int i;
-    if (vis()) for (i=0; i<indent;i++) printf("    ");
+    if (vis()) for (i=0; i<indent;i++) sdp_printf("    ");
     unsigned int pos     = de_get_header_size(element);
     unsigned int end_pos = de_get_len(element);
-    if (vis()) printf("type %5s (%u), element len %2u ", type_names[de_type], de_type, end_pos);
+    if (vis()) sdp_printf("type %5s (%u), element len %2u ", type_names[de_type], de_type, end_pos);
     if (de_type == DE_DES) {
-		if (vis()) printf("\n");
+		if (vis()) sdp_printf("\n");
         s_dump_row++;
-        indent++;
-        de_traverse_sequence(element, de_traversal_dump_data, (void *)&indent);
     } else if (de_type == DE_UUID && de_size == DE_SIZE_128) {
-        if(vis()) printf(", value: %s\n", uuid128_to_str(element+1));
+        if(vis()) sdp_printf(", value: %s\n", uuid128_to_str(element+1));
     } else if (de_type == DE_STRING) {
         unsigned int len = 0;
         switch (de_size){
@@ -753,12 +964,12 @@ static int de_traversal_dump_data(const uint8_t * element, de_type_t de_type, de
                 break;
         }
         if (vis()) {
-            printf(", len %2u, value: '", len);
+            sdp_printf(", len %2u, value: '", len);
             for (i=0;i<len;i++){
                 uint8_t c = element[pos + i];
-                printf("%c", (c >= 0x20 && c <= 0x7f) ? c : '.');
+                sdp_printf("%c", (c >= 0x20 && c <= 0x7f) ? c : '.');
             }
-            printf("'\n");
+            sdp_printf("'\n");
         }
         s_dump_row++;
     } else {
@@ -778,25 +989,45 @@ static int de_traversal_dump_data(const uint8_t * element, de_type_t de_type, de
             default:
                 break;
         }
-        if (vis()) printf(", value: 0x%08" PRIx32 "\n", value);
+        if (vis()) sdp_printf(", value: 0x%08" PRIx32 "\n", value);
         s_dump_row++;
     }
-    return 0;
+}
+
+static void de_dump_error(uint32_t offset, unsigned int indent){
+    unsigned int i;
+    if (vis()) for (i=0; i<indent;i++) sdp_printf("    ");
+    if (vis()) sdp_printf("malformed data element at offset %" PRIu32 "\n", offset);
+    s_dump_row++;
+}
+
+// dumps all elements in data, stopping at the first one which does not fit
+static void de_dump_tree(const uint8_t * data, uint32_t size, unsigned int indent){
+    de_cursor_t cursor;
+    de_cursor_init(&cursor, data, size);
+    bool enter = false;
+    while (de_cursor_next(&cursor, enter)){
+        const uint8_t * element = de_cursor_element(&cursor);
+        de_type_t de_type = de_get_element_type(element);
+        de_size_t de_size = de_get_size_type(element);
+        de_dump_row(element, de_type, de_size, indent + cursor.depth);
+        enter = de_type == DE_DES;
+    }
+    if (cursor.error) {
+        de_dump_error(cursor.pos, indent + cursor.depth);
+    }
 }
 #endif
 
-void de_dump_data_element(const uint8_t * record, int from_row, int max_rows){
+void de_dump_data_element(const uint8_t * record, uint32_t size, int from_row, int max_rows){
 #ifdef ENABLE_SDP_DES_DUMP
-    unsigned int indent = 0;
     s_dump_row = 0;
     s_dump_from_row = from_row;
     s_dump_max_rows = max_rows;
-    // hack to get root DES, too.
-    de_type_t type = de_get_element_type(record);
-    de_size_t size = de_get_size_type(record);
-    de_traversal_dump_data(record, type, size, (void*) &indent);
+    de_dump_tree(record, size, 0);
 #else
 UNUSED(record);
+UNUSED(size);
 #endif
 }
 
@@ -810,6 +1041,51 @@ uint8_t* sdp_service_search_pattern_for_uuid128(const uint8_t * uuid128){
     return (uint8_t*)des_service_search_pattern_uuid128;
 }
 
+uint16_t sdp_service_search_pattern_build(uint8_t *buffer, uint16_t buffer_size,
+                                          const uint16_t *uuid16s, int num_uuid16s,
+                                          const uint8_t *uuid128s, int num_uuid128s){
+    if (num_uuid16s < 0 || num_uuid128s < 0) return 0;
+    if (num_uuid16s + num_uuid128s == 0 ||
+        num_uuid16s + num_uuid128s > SDP_SERVICE_SEARCH_PATTERN_MAX_UUIDS) return 0;
+    if (3 + num_uuid16s * 3 + num_uuid128s * 17 > buffer_size) return 0;
+
+    de_create_sequence(buffer);
+    for (int i = 0; i < num_uuid16s; i++){
+        de_add_number(buffer, DE_UUID, DE_SIZE_16, uuid16s[i]);
+    }
+    for (int i = 0; i < num_uuid128s; i++){
+        uint16_t data_size = big_endian_read_16(buffer, 1);
+        de_store_descriptor(buffer + 3 + data_size, DE_UUID, DE_SIZE_128);
+        (void)memcpy(buffer + 4 + data_size, uuid128s + i * 16, 16);
+        big_endian_store_16(buffer, 1, data_size + 17);
+    }
+    return de_get_len(buffer);
+}
+
+uint16_t sdp_attribute_id_list_build(uint8_t *buffer, uint16_t buffer_size,
+                                     const SdpAttributeRange *ranges,
+                                     int num_ranges){
+    if (num_ranges <= 0 || num_ranges > SDP_ATTRIBUTE_ID_LIST_MAX_RANGES) return 0;
+
+    uint32_t size = 3;
+    for (int i = 0; i < num_ranges; i++){
+        if (ranges[i].first > ranges[i].last) return 0;
+        size += ranges[i].first == ranges[i].last ? 3 : 5;
+    }
+    if (size > buffer_size) return 0;
+
+    de_create_sequence(buffer);
+    for (int i = 0; i < num_ranges; i++){
+        if (ranges[i].first == ranges[i].last){
+            de_add_number(buffer, DE_UINT, DE_SIZE_16, ranges[i].first);
+        } else {
+            de_add_number(buffer, DE_UINT, DE_SIZE_32,
+                          ((uint32_t)ranges[i].first << 16) | ranges[i].last);
+        }
+    }
+    return de_get_len(buffer);
+}
+
 
 #include "bluetooth_sdp.h"
 #include "report_item.h"
@@ -846,111 +1122,235 @@ typedef struct {
     SdpAttributeValueType value_type;
 } SdpAttribute;
 
+/*
+ * Attribute descriptors are kept in dense tables, indexed by the attribute
+ * ID minus the table base, so that a lookup is a range check and an array
+ * access; empty slots have a NULL name.
+ */
+typedef struct {
+    uint16_t base;
+    uint16_t count;
+    const SdpAttribute *attributes;
+} SdpAttributeTable;
+
+#define SDP_ATTRIBUTE_TABLE(base, attributes) \
+    { base, sizeof(attributes) / sizeof(attributes[0]), attributes }
+
 static const SdpAttribute s_sdp_universal_attributes[] = {
-    { 0x0000, "ServiceRecordHandle", SDP_TYPE_HEX32 },
-    { 0x0001, "ServiceClassIDList", SDP_CLASS_LIST },
-    { 0x0002, "ServiceRecordState", SDP_TYPE_HEX32 },
-    { 0x0003, "ServiceID", SDP_TYPE_UUID },
-    { 0x0004, "ProtocolDescriptorList", SDP_PROT_DESC_LIST },
-    { 0x0005, "BrowseGroupList", SDP_CLASS_LIST },
-    { 0x0006, "LanguageBaseAttributeIDList", SDP_LANGUAGE_LIST },
-    { 0x0007, "ServiceInfoTimeToLive", SDP_TYPE_UINT32 },
-    { 0x0008, "ServiceAvailability", SDP_TYPE_HEX8 },
-    { 0x0009, "BluetoothProfileDescriptorList", SDP_PROF_DESC_LIST },
-    { 0x000A, "DocumentationURL", SDP_TYPE_URL },
-    { 0x000B, "ClientExecutableURL", SDP_TYPE_URL },
-    { 0x000C, "IconURL", SDP_TYPE_URL },
-    { 0x000D, "AdditionalProtocolDescriptorLists", SDP_ADD_PROT_DESC_LIST },
-    { 0, NULL, SDP_TYPE_ANY }
+    [0x0000] = { 0x0000, "ServiceRecordHandle", SDP_TYPE_HEX32 },
+    [0x0001] = { 0x0001, "ServiceClassIDList", SDP_CLASS_LIST },
+    [0x0002] = { 0x0002, "ServiceRecordState", SDP_TYPE_HEX32 },
+    [0x0003] = { 0x0003, "ServiceID", SDP_TYPE_UUID },
+    [0x0004] = { 0x0004, "ProtocolDescriptorList", SDP_PROT_DESC_LIST },
+    [0x0005] = { 0x0005, "BrowseGroupList", SDP_CLASS_LIST },
+    [0x0006] = { 0x0006, "LanguageBaseAttributeIDList", SDP_LANGUAGE_LIST },
+    [0x0007] = { 0x0007, "ServiceInfoTimeToLive", SDP_TYPE_UINT32 },
+    [0x0008] = { 0x0008, "ServiceAvailability", SDP_TYPE_HEX8 },
+    [0x0009] = { 0x0009, "BluetoothProfileDescriptorList", SDP_PROF_DESC_LIST },
+    [0x000A] = { 0x000A, "DocumentationURL", SDP_TYPE_URL },
+    [0x000B] = { 0x000B, "ClientExecutableURL", SDP_TYPE_URL },
+    [0x000C] = { 0x000C, "IconURL", SDP_TYPE_URL },
+    [0x000D] = { 0x000D, "AdditionalProtocolDescriptorLists", SDP_ADD_PROT_DESC_LIST },
 };
 
 static const SdpAttribute s_sdp_translatable_attributes[] = {
-    { 0x0000, "ServiceName", SDP_TYPE_STRING },
-    { 0x0001, "ServiceDescription", SDP_TYPE_STRING },
-    { 0x0002, "ProviderName", SDP_TYPE_STRING },
-    { 0, NULL, SDP_TYPE_ANY }
+    [0x0000] = { 0x0000, "ServiceName", SDP_TYPE_STRING },
+    [0x0001] = { 0x0001, "ServiceDescription", SDP_TYPE_STRING },
+    [0x0002] = { 0x0002, "ProviderName", SDP_TYPE_STRING },
+};
+
+static const SdpAttributeTable s_sdp_universal_table =
+    SDP_ATTRIBUTE_TABLE(0x0000, s_sdp_universal_attributes);
+static const SdpAttributeTable s_sdp_translatable_table =
+    SDP_ATTRIBUTE_TABLE(0x0000, s_sdp_translatable_attributes);
+
+static const SdpAttribute s_sdp_sds_attributes[] = {
+    [0x0200 - 0x0200] = { 0x0200, "VersionNumberList", SDP_TYPE_ANY },
+    [0x0201 - 0x0200] = { 0x0201, "ServiceDatabaseState", SDP_TYPE_HEX32 },
 };
 
 static const SdpAttribute s_sdp_hid_attributes[] = {
-    { 0x0200, "HIDDeviceReleaseNumber", SDP_VERSION_JJMN },
-    { 0x0201, "HIDParserVersion", SDP_VERSION_JJMN },
-    { 0x0202, "HIDDeviceSubclass", SDP_TYPE_UINT8 },
-    { 0x0203, "HIDCountryCode", SDP_TYPE_UINT8 },
-    { 0x0204, "HIDVirtualCable", SDP_TYPE_BOOL },
-    { 0x0205, "HIDReconnectInitiate", SDP_TYPE_BOOL },
-    { 0x0206, "HIDDescriptorList", SDP_HID_DESC_LIST },
-    { 0x0207, "HIDLANGIDBaseList", SDP_HID_LANGUAGE_LIST },
-    { 0x0208, "HIDSDPDisable", SDP_TYPE_BOOL },
-    { 0x0209, "HIDBatteryPower", SDP_TYPE_BOOL },
-    { 0x020A, "HIDRemoteWake", SDP_TYPE_BOOL },
-    { 0x020B, "HIDProfileVersion", SDP_VERSION_JJMN },
-    { 0x020C, "HIDSupervisionTimeout", SDP_TYPE_UINT16 },
-    { 0x020D, "HIDNormallyConnectable", SDP_TYPE_BOOL },
-    { 0x020E, "HIDBootDevice", SDP_TYPE_BOOL },
-    { 0x020F, "HIDSSRHostMaxLatency", SDP_TYPE_UINT16 },
-    { 0x0210, "HIDSSRHostMinTimeout", SDP_TYPE_UINT16 },
-    { 0, NULL, SDP_TYPE_ANY }
+    [0x0200 - 0x0200] = { 0x0200, "HIDDeviceReleaseNumber", SDP_VERSION_JJMN },
+    [0x0201 - 0x0200] = { 0x0201, "HIDParserVersion", SDP_VERSION_JJMN },
+    [0x0202 - 0x0200] = { 0x0202, "HIDDeviceSubclass", SDP_TYPE_UINT8 },
+    [0x0203 - 0x0200] = { 0x0203, "HIDCountryCode", SDP_TYPE_UINT8 },
+    [0x0204 - 0x0200] = { 0x0204, "HIDVirtualCable", SDP_TYPE_BOOL },
+    [0x0205 - 0x0200] = { 0x0205, "HIDReconnectInitiate", SDP_TYPE_BOOL },
+    [0x0206 - 0x0200] = { 0x0206, "HIDDescriptorList", SDP_HID_DESC_LIST },
+    [0x0207 - 0x0200] = { 0x0207, "HIDLANGIDBaseList", SDP_HID_LANGUAGE_LIST },
+    [0x0208 - 0x0200] = { 0x0208, "HIDSDPDisable", SDP_TYPE_BOOL },
+    [0x0209 - 0x0200] = { 0x0209, "HIDBatteryPower", SDP_TYPE_BOOL },
+    [0x020A - 0x0200] = { 0x020A, "HIDRemoteWake", SDP_TYPE_BOOL },
+    [0x020B - 0x0200] = { 0x020B, "HIDProfileVersion", SDP_VERSION_JJMN },
+    [0x020C - 0x0200] = { 0x020C, "HIDSupervisionTimeout", SDP_TYPE_UINT16 },
+    [0x020D - 0x0200] = { 0x020D, "HIDNormallyConnectable", SDP_TYPE_BOOL },
+    [0x020E - 0x0200] = { 0x020E, "HIDBootDevice", SDP_TYPE_BOOL },
+    [0x020F - 0x0200] = { 0x020F, "HIDSSRHostMaxLatency", SDP_TYPE_UINT16 },
+    [0x0210 - 0x0200] = { 0x0210, "HIDSSRHostMinTimeout", SDP_TYPE_UINT16 },
 };
 
 static const SdpAttribute s_sdp_did_attributes[] = {
-    { 0x0200, "SpecificationID", SDP_VERSION_JJMM },
-    { 0x0201, "VendorID", SDP_TYPE_HEX16 },
-    { 0x0202, "ProductID", SDP_TYPE_HEX16 },
-    { 0x0203, "Version", SDP_VERSION_JJMN },
-    { 0x0204, "PrimaryRecord", SDP_TYPE_BOOL },
-    { 0x0205, "VendorIDSource", SDP_TYPE_UINT16 },
-    { 0, NULL, SDP_TYPE_ANY }
+    [0x0200 - 0x0200] = { 0x0200, "SpecificationID", SDP_VERSION_JJMM },
+    [0x0201 - 0x0200] = { 0x0201, "VendorID", SDP_TYPE_HEX16 },
+    [0x0202 - 0x0200] = { 0x0202, "ProductID", SDP_TYPE_HEX16 },
+    [0x0203 - 0x0200] = { 0x0203, "Version", SDP_VERSION_JJMN },
+    [0x0204 - 0x0200] = { 0x0204, "PrimaryRecord", SDP_TYPE_BOOL },
+    [0x0205 - 0x0200] = { 0x0205, "VendorIDSource", SDP_TYPE_UINT16 },
 };
 
-typedef struct {
-    uint16_t class_id;
-    const SdpAttribute *attributes;
-} SdpClassAttributes;
+/* A2DP, AVRCP and HFP (hands-free unit) */
+static const SdpAttribute s_sdp_supported_features_attributes[] = {
+    [0x0311 - 0x0311] = { 0x0311, "SupportedFeatures", SDP_TYPE_HEX16 },
+};
+
+static const SdpAttribute s_sdp_hfp_ag_attributes[] = {
+    [0x0301 - 0x0301] = { 0x0301, "Network", SDP_TYPE_UINT8 },
+    [0x0311 - 0x0301] = { 0x0311, "SupportedFeatures", SDP_TYPE_HEX16 },
+};
+
+static const SdpAttribute s_sdp_hsp_attributes[] = {
+    [0x0302 - 0x0302] = { 0x0302, "RemoteAudioVolumeControl", SDP_TYPE_BOOL },
+};
+
+static const SdpAttribute s_sdp_pan_attributes[] = {
+    [0x030A - 0x030A] = { 0x030A, "SecurityDescription", SDP_TYPE_UINT16 },
+    [0x030B - 0x030A] = { 0x030B, "NetAccessType", SDP_TYPE_UINT16 },
+    [0x030C - 0x030A] = { 0x030C, "MaxNetAccessrate", SDP_TYPE_UINT32 },
+    [0x030D - 0x030A] = { 0x030D, "IPv4Subnet", SDP_TYPE_STRING },
+    [0x030E - 0x030A] = { 0x030E, "IPv6Subnet", SDP_TYPE_STRING },
+};
+
+/* OBEX based profiles */
+static const SdpAttribute s_sdp_goep_attributes[] = {
+    [0x0200 - 0x0200] = { 0x0200, "GoepL2capPsm", SDP_TYPE_HEX16 },
+};
+
+static const SdpAttribute s_sdp_opp_attributes[] = {
+    [0x0303 - 0x0303] = { 0x0303, "SupportedFormatsList", SDP_TYPE_ANY },
+};
+
+static const SdpAttribute s_sdp_pbap_attributes[] = {
+    [0x0314 - 0x0314] = { 0x0314, "SupportedRepositories", SDP_TYPE_HEX8 },
+    [0x0317 - 0x0314] = { 0x0317, "PbapSupportedFeatures", SDP_TYPE_HEX32 },
+};
 
-static const SdpClassAttributes s_sdp_attibutes[] = {
-    {
-        0,
-        s_sdp_universal_attributes,
-    },
-    {
-        BLUETOOTH_SERVICE_CLASS_HUMAN_INTERFACE_DEVICE_SERVICE,
-        s_sdp_hid_attributes
-    },
-    {
-        BLUETOOTH_SERVICE_CLASS_PNP_INFORMATION,
-        s_sdp_did_attributes
-    },
-    { 0, NULL },
+static const SdpAttribute s_sdp_map_attributes[] = {
+    [0x0315 - 0x0315] = { 0x0315, "MASInstanceID", SDP_TYPE_UINT8 },
+    [0x0316 - 0x0315] = { 0x0316, "SupportedMessageTypes", SDP_TYPE_HEX8 },
+    [0x0317 - 0x0315] = { 0x0317, "MapSupportedFeatures", SDP_TYPE_HEX32 },
 };
 
-static const SdpAttribute *sdp_class_attributes_find(
-    const SdpAttribute *attributes,
+static const SdpAttributeTable s_sdp_sds_table =
+    SDP_ATTRIBUTE_TABLE(0x0200, s_sdp_sds_attributes);
+static const SdpAttributeTable s_sdp_hid_table =
+    SDP_ATTRIBUTE_TABLE(0x0200, s_sdp_hid_attributes);
+static const SdpAttributeTable s_sdp_did_table =
+    SDP_ATTRIBUTE_TABLE(0x0200, s_sdp_did_attributes);
+static const SdpAttributeTable s_sdp_supported_features_table =
+    SDP_ATTRIBUTE_TABLE(0x0311, s_sdp_supported_features_attributes);
+static const SdpAttributeTable s_sdp_hfp_ag_table =
+    SDP_ATTRIBUTE_TABLE(0x0301, s_sdp_hfp_ag_attributes);
+static const SdpAttributeTable s_sdp_hsp_table =
+    SDP_ATTRIBUTE_TABLE(0x0302, s_sdp_hsp_attributes);
+static const SdpAttributeTable s_sdp_pan_table =
+    SDP_ATTRIBUTE_TABLE(0x030A, s_sdp_pan_attributes);
+static const SdpAttributeTable s_sdp_goep_table =
+    SDP_ATTRIBUTE_TABLE(0x0200, s_sdp_goep_attributes);
+static const SdpAttributeTable s_sdp_opp_table =
+    SDP_ATTRIBUTE_TABLE(0x0303, s_sdp_opp_attributes);
+static const SdpAttributeTable s_sdp_pbap_table =
+    SDP_ATTRIBUTE_TABLE(0x0314, s_sdp_pbap_attributes);
+static const SdpAttributeTable s_sdp_map_table =
+    SDP_ATTRIBUTE_TABLE(0x0315, s_sdp_map_attributes);
+
+/* Profile specific attributes live in at most two ranges (0x02xx, 0x03xx) */
+typedef struct {
+    const SdpAttributeTable *tables[2];
+} SdpClassAttributes;
+
+static const SdpClassAttributes s_sdp_sds_class = {{ &s_sdp_sds_table }};
+static const SdpClassAttributes s_sdp_hid_class = {{ &s_sdp_hid_table }};
+static const SdpClassAttributes s_sdp_did_class = {{ &s_sdp_did_table }};
+static const SdpClassAttributes s_sdp_supported_features_class = {{
+    &s_sdp_supported_features_table
+}};
+static const SdpClassAttributes s_sdp_hfp_ag_class = {{ &s_sdp_hfp_ag_table }};
+static const SdpClassAttributes s_sdp_hsp_class = {{ &s_sdp_hsp_table }};
+static const SdpClassAttributes s_sdp_pan_class = {{ &s_sdp_pan_table }};
+static const SdpClassAttributes s_sdp_goep_class = {{ &s_sdp_goep_table }};
+static const SdpClassAttributes s_sdp_opp_class = {{
+    &s_sdp_goep_table, &s_sdp_opp_table
+}};
+static const SdpClassAttributes s_sdp_pbap_class = {{
+    &s_sdp_goep_table, &s_sdp_pbap_table
+}};
+static const SdpClassAttributes s_sdp_map_class = {{
+    &s_sdp_goep_table, &s_sdp_map_table
+}};
+
+static const SdpClassAttributes *sdp_class_attributes(uint16_t class_id)
+{
+    switch (class_id) {
+    case BLUETOOTH_SERVICE_CLASS_SERVICE_DISCOVERY_SERVER:
+        return &s_sdp_sds_class;
+    case BLUETOOTH_SERVICE_CLASS_HUMAN_INTERFACE_DEVICE_SERVICE:
+        return &s_sdp_hid_class;
+    case BLUETOOTH_SERVICE_CLASS_PNP_INFORMATION:
+        return &s_sdp_did_class;
+    case BLUETOOTH_SERVICE_CLASS_AUDIO_SOURCE:
+    case BLUETOOTH_SERVICE_CLASS_AUDIO_SINK:
+    case BLUETOOTH_SERVICE_CLASS_AV_REMOTE_CONTROL_TARGET:
+    case BLUETOOTH_SERVICE_CLASS_AV_REMOTE_CONTROL:
+    case BLUETOOTH_SERVICE_CLASS_AV_REMOTE_CONTROL_CONTROLLER:
+    case BLUETOOTH_SERVICE_CLASS_HANDSFREE:
+        return &s_sdp_supported_features_class;
+    case BLUETOOTH_SERVICE_CLASS_HANDSFREE_AUDIO_GATEWAY:
+        return &s_sdp_hfp_ag_class;
+    case BLUETOOTH_SERVICE_CLASS_HEADSET:
+    case BLUETOOTH_SERVICE_CLASS_HEADSET_HS:
+        return &s_sdp_hsp_class;
+    case BLUETOOTH_SERVICE_CLASS_PANU:
+    case BLUETOOTH_SERVICE_CLASS_NAP:
+    case BLUETOOTH_SERVICE_CLASS_GN:
+        return &s_sdp_pan_class;
+    case BLUETOOTH_SERVICE_CLASS_OBEX_FILE_TRANSFER:
+    case BLUETOOTH_SERVICE_CLASS_MESSAGE_NOTIFICATION_SERVER:
+        return &s_sdp_goep_class;
+    case BLUETOOTH_SERVICE_CLASS_OBEX_OBJECT_PUSH:
+        return &s_sdp_opp_class;
+    case BLUETOOTH_SERVICE_CLASS_PHONEBOOK_ACCESS_PSE:
+        return &s_sdp_pbap_class;
+    case BLUETOOTH_SERVICE_CLASS_MESSAGE_ACCESS_SERVER:
+        return &s_sdp_map_class;
+    default:
+        return NULL;
+    }
+}
+
+static const SdpAttribute *sdp_attribute_table_find(
+    const SdpAttributeTable *table,
     uint16_t attribute_id)
 {
-    for (const SdpAttribute *a = attributes; a->name != NULL; a++) {
-        if (a->id == attribute_id) return a;
-    }
-    return NULL;
+    /* IDs below the base wrap around and fail the range check */
+    uint16_t i = attribute_id - table->base;
+    if (i >= table->count) return NULL;
+
+    const SdpAttribute *a = &table->attributes[i];
+    return a->name ? a : NULL;
 }
 
 static const SdpAttribute *sdp_get_attribute_record(uint16_t class_id,
                                                     uint16_t attribute_id)
 {
-    const SdpAttribute *attributes = NULL;
-    for (const SdpClassAttributes *ca = s_sdp_attibutes;
-         ca->attributes != NULL;
-         ca++) {
-        if (ca->class_id == class_id) {
-            attributes = ca->attributes;
-            break;
+    const SdpClassAttributes *ca = sdp_class_attributes(class_id);
+    if (ca) {
+        for (int i = 0; i < 2 && ca->tables[i]; i++) {
+            const SdpAttribute *attr =
+                sdp_attribute_table_find(ca->tables[i], attribute_id);
+            if (attr) return attr;
         }
     }
-    if (attributes) {
-        const SdpAttribute *attr =
-            sdp_class_attributes_find(attributes, attribute_id);
-        if (attr) return attr;
-    }
-    return sdp_class_attributes_find(s_sdp_universal_attributes, attribute_id);
+    return sdp_attribute_table_find(&s_sdp_universal_table, attribute_id);
 }
 
 typedef struct {
@@ -966,7 +1366,7 @@ typedef struct {
 
 static void indent(const SdpContext *context)
 {
-    if (vis()) for (int i = 0; i < context->indent; i++) printf("  ");
+    if (vis()) for (int i = 0; i < context->indent; i++) sdp_printf("  ");
 }
 
 static int bcd_byte(uint8_t byte)
@@ -983,9 +1383,7 @@ static void sdp_print_element(SdpContext *context, SdpAttributeValueType type,
 static void sdp_print_generic(SdpContext *context, SdpAttributeValueType,
                               const uint8_t *element)
 {
-    de_type_t type = de_get_element_type(element);
-    de_size_t size = de_get_size_type(element);
-    de_traversal_dump_data((uint8_t *)element, type, size, &context->indent);
+    de_dump_tree(element, de_get_len(element), context->indent);
 }
 
 static void sdp_print_bool(SdpContext *context, SdpAttributeValueType t,
@@ -999,7 +1397,7 @@ static void sdp_print_bool(SdpContext *context, SdpAttributeValueType t,
     }
     int pos = de_get_header_size(element);
     bool value = element[pos];
-    if (vis()) printf("%s", value ? "true" : "false");
+    if (vis()) sdp_printf("%s", value ? "true" : "false");
 }
 
 static void sdp_print_uint(SdpContext *context, SdpAttributeValueType t,
@@ -1016,7 +1414,19 @@ static void sdp_print_uint(SdpContext *context, SdpAttributeValueType t,
     if (size == DE_SIZE_8) value = element[pos];
     else if (size == DE_SIZE_16) value = big_endian_read_16(element, pos);
     else if (size == DE_SIZE_32) value = big_endian_read_32(element, pos);
-    if (vis()) printf("%d", value);
+    if (vis()) sdp_printf("%d", value);
+}
+
+static void sdp_print_hex8(SdpContext *context, SdpAttributeValueType t,
+                           const uint8_t *element)
+{
+    de_size_t size = de_get_size_type(element);
+    if (size != DE_SIZE_8) {
+        sdp_print_generic(context, t, element);
+        return;
+    }
+    int pos = de_get_header_size(element);
+    if (vis()) sdp_printf("0x%02x", element[pos]);
 }
 
 static void sdp_print_hex16(SdpContext *context, SdpAttributeValueType t,
@@ -1029,7 +1439,7 @@ static void sdp_print_hex16(SdpContext *context, SdpAttributeValueType t,
     }
     int pos = de_get_header_size(element);
     uint32_t value = big_endian_read_16(element, pos);
-    if (vis()) printf("0x%04" PRIx16, value);
+    if (vis()) sdp_printf("0x%04" PRIx16, value);
 }
 
 static void sdp_print_hex32(SdpContext *context, SdpAttributeValueType t,
@@ -1042,7 +1452,7 @@ static void sdp_print_hex32(SdpContext *context, SdpAttributeValueType t,
     }
     int pos = de_get_header_size(element);
     uint32_t value = big_endian_read_32(element, pos);
-    if (vis()) printf("0x%08" PRIx32, value);
+    if (vis()) sdp_printf("0x%08" PRIx32, value);
 }
 
 static void sdp_print_uuid(SdpContext *context, SdpAttributeValueType t,
@@ -1056,7 +1466,7 @@ static void sdp_print_uuid(SdpContext *context, SdpAttributeValueType t,
     }
     int pos = de_get_header_size(element);
     uint32_t value = big_endian_read_16(element, pos);
-    if (vis()) printf("0x%04" PRIx16, value);
+    if (vis()) sdp_printf("0x%04" PRIx16, value);
     context->last_uuid = value;
 }
 
@@ -1075,7 +1485,7 @@ static void sdp_print_string(SdpContext *context, SdpAttributeValueType t,
     if (vis()) {
         for (int i = 0; i < len; i++) {
             uint8_t c = element[pos + i];
-            printf("%c", (c >= 0x20 && c <= 0x7f) ? c : '.');
+            sdp_printf("%c", (c >= 0x20 && c <= 0x7f) ? c : '.');
         }
     }
 }
@@ -1090,7 +1500,7 @@ static void sdp_print_lang_code(SdpContext *context, SdpAttributeValueType t,
         return;
     }
     int pos = de_get_header_size(element);
-    if (vis()) printf("%c%c", (char)element[pos], (char)element[pos+1]);
+    if (vis()) sdp_printf("%c%c", (char)element[pos], (char)element[pos+1]);
 }
 
 static void sdp_print_version_jjmm(SdpContext *context, SdpAttributeValueType t,
@@ -1103,7 +1513,7 @@ static void sdp_print_version_jjmm(SdpContext *context, SdpAttributeValueType t,
         return;
     }
     int pos = de_get_header_size(element);
-    if (vis()) printf("%d.%d", bcd_byte(element[pos]), bcd_byte(element[pos+1]));
+    if (vis()) sdp_printf("%d.%d", bcd_byte(element[pos]), bcd_byte(element[pos+1]));
 }
 
 static void sdp_print_version_jjmn(SdpContext *context, SdpAttributeValueType t,
@@ -1117,7 +1527,7 @@ static void sdp_print_version_jjmn(SdpContext *context, SdpAttributeValueType t,
     }
     int pos = de_get_header_size(element);
     uint8_t mn = element[pos + 1];
-    if (vis()) printf("%d.%d.%d", bcd_byte(element[pos]), mn / 16, mn % 16);
+    if (vis()) sdp_printf("%d.%d.%d", bcd_byte(element[pos]), mn / 16, mn % 16);
 }
 
 static void print_attribute_id(SdpContext *context, const uint8_t *element,
@@ -1131,19 +1541,20 @@ static void print_attribute_id(SdpContext *context, const uint8_t *element,
         value = big_endian_read_16(element, pos);
         attr = sdp_get_attribute_record(context->service_class_id, value);
         if (!attr && context->lang_offset > 0) {
-            attr = sdp_class_attributes_find(s_sdp_translatable_attributes, value - context->lang_offset);
+            attr = sdp_attribute_table_find(&s_sdp_translatable_table,
+                                            value - context->lang_offset);
         }
     }
 
     if (attr) {
-        if (vis()) { indent(context); printf("%s: ", attr->name); }
+        if (vis()) { indent(context); sdp_printf("%s: ", attr->name); }
         context->expected_type = attr->value_type;
         context->last_attribute_id = value;
         /* TODO: can we get rid of this and print the newline in the handler? */
         switch (attr->value_type) {
         case SDP_TYPE_ANY:
         case SDP_ATTR_LIST:
-            if (vis()) printf("\n");
+            if (vis()) sdp_printf("\n");
             s_dump_row++;
         default: break;
         }
@@ -1171,9 +1582,9 @@ static int sdp_print_class_list_cb(const uint8_t *element,
         context->service_class_id = value;
     }
 
-    if (vis()) printf("\n");
+    if (vis()) sdp_printf("\n");
     s_dump_row++;
-    if (vis()) { indent(context); printf("- 0x%04" PRIx16, value); }
+    if (vis()) { indent(context); sdp_printf("- 0x%04" PRIx16, value); }
     return 0;
 }
 
@@ -1200,10 +1611,27 @@ static int sdp_print_prot_desc_cb2(const uint8_t *element,
 
     sdp_print_element(context, context->expected_type, element);
     if (context->sequence_index == 0) {
-        if (context->last_uuid == BLUETOOTH_PROTOCOL_L2CAP) {
-            if (vis()) printf(", PSM=");
+        switch (context->last_uuid) {
+        case BLUETOOTH_PROTOCOL_L2CAP:
+            if (vis()) sdp_printf(", PSM=");
             context->expected_type = SDP_TYPE_UINT16;
+            break;
+        case BLUETOOTH_PROTOCOL_RFCOMM:
+            if (vis()) sdp_printf(", channel=");
+            context->expected_type = SDP_TYPE_UINT8;
+            break;
+        case BLUETOOTH_PROTOCOL_BNEP:
+        case BLUETOOTH_PROTOCOL_AVCTP:
+        case BLUETOOTH_PROTOCOL_AVDTP:
+            if (vis()) sdp_printf(", version ");
+            context->expected_type = SDP_VERSION_JJMM;
+            break;
+        default:
+            break;
         }
+    } else {
+        /* e.g. the list of network packet types supported by BNEP */
+        context->expected_type = SDP_TYPE_ANY;
     }
     context->sequence_index++;
     return 0;
@@ -1220,9 +1648,9 @@ static int sdp_print_prot_desc_cb(const uint8_t *element,
         return 0;
     }
 
-    if (vis()) printf("\n");
+    if (vis()) sdp_printf("\n");
     s_dump_row++;
-    if (vis()) { indent(context); printf("- "); }
+    if (vis()) { indent(context); sdp_printf("- "); }
     context->expected_type = SDP_TYPE_UUID;
     context->last_uuid = 0;
     context->sequence_index = 0;
@@ -1253,11 +1681,11 @@ static int sdp_print_add_prot_desc_cb(const uint8_t *element,
         return 0;
     }
 
-    if (vis()) printf("\n");
+    if (vis()) sdp_printf("\n");
     s_dump_row++;
     if (vis()) {
         indent(context);
-        printf("- List #%d", context->sequence_index + 1);
+        sdp_printf("- List #%d", context->sequence_index + 1);
     }
     context->sequence_index++;
     context->expected_type = SDP_PROT_DESC_LIST;
@@ -1287,7 +1715,7 @@ static int sdp_print_prof_desc_cb2(const uint8_t *element,
     SdpContext *context = my_context;
     sdp_print_element(context, context->expected_type, element);
     if (context->sequence_index == 0) {
-        if (vis()) printf(", version ");
+        if (vis()) sdp_printf(", version ");
         context->expected_type = SDP_VERSION_JJMM;
     }
     context->sequence_index++;
@@ -1305,9 +1733,9 @@ static int sdp_print_prof_desc_cb(const uint8_t *element,
         return 0;
     }
 
-    if (vis()) printf("\n");
+    if (vis()) sdp_printf("\n");
     s_dump_row++;
-    if (vis()) { indent(context); printf("- "); }
+    if (vis()) { indent(context); sdp_printf("- "); }
     context->expected_type = SDP_TYPE_UUID;
     context->sequence_index = 0;
     de_traverse_sequence(element, sdp_print_prof_desc_cb2, context);
@@ -1335,7 +1763,7 @@ static int sdp_print_hid_desc_cb2(const uint8_t *element,
     if (context->sequence_index == 0) {
         const char *descriptor_type;
         context->expected_type = SDP_TYPE_ANY;
-        switch (element[pos]) {
+        switch (de_get_data_size(element) > 0 ? element[pos] : 0) {
         case 0x22:
             descriptor_type = "Report";
             context->expected_type = SDP_HID_DESC_REPORT;
@@ -1346,7 +1774,7 @@ static int sdp_print_hid_desc_cb2(const uint8_t *element,
         default:
             descriptor_type = "Unknown";
         }
-        if (vis()) printf("%s descriptor:", descriptor_type);
+        if (vis()) sdp_printf("%s descriptor:", descriptor_type);
     } else {
         sdp_print_element(context, context->expected_type, element);
     }
@@ -1365,9 +1793,9 @@ static int sdp_print_hid_desc_cb(const uint8_t *element,
         return 0;
     }
 
-    if (vis()) { printf("\n"); }
+    if (vis()) { sdp_printf("\n"); }
     s_dump_row++;
-    if (vis()) { indent(context); printf("- "); }
+    if (vis()) { indent(context); sdp_printf("- "); }
     context->sequence_index = 0;
     context->indent++;
     de_traverse_sequence(element, sdp_print_hid_desc_cb2, context);
@@ -1387,12 +1815,23 @@ static void sdp_print_hid_desc_list(SdpContext *context, SdpAttributeValueType t
     de_traverse_sequence(element, sdp_print_hid_desc_cb, context);
 }
 
-static void ri_print_cb(const char *text, void *my_context)
+static void sdp_line_cache_add_item(SdpLineCache *cache, const RiItem *item);
+
+static void ri_item_cb(const RiItem *item, void *my_context)
 {
     SdpContext *context = my_context;
-    if (vis()) printf("\n");
+    if (vis()) sdp_printf("\n");
     s_dump_row++;
-    if (vis()) { indent(context); printf("%s", text); }
+    // Items outside of the window are only counted
+    if (!vis()) return;
+    indent(context);
+    if (s_line_cache) {
+        // formatted by sdp_line_cache_print(), if the row is ever shown
+        sdp_line_cache_add_item(s_line_cache, item);
+    } else {
+        char text[RI_ITEM_STR_SIZE];
+        sdp_printf("%s", ri_FormatItem(item, text));
+    }
 }
 
 static void sdp_print_hid_desc_report(SdpContext *context, SdpAttributeValueType t,
@@ -1409,7 +1848,7 @@ static void sdp_print_hid_desc_report(SdpContext *context, SdpAttributeValueType
     int len = (size == DE_SIZE_VAR_8) ?
         element[1] : big_endian_read_16(element, 1);
 
-    ri_Parse(element + pos, len, ri_print_cb, context);
+    ri_ParseItems(element + pos, len, ri_item_cb, context);
 }
 
 static int sdp_print_hid_language_list_cb2(const uint8_t *element,
@@ -1418,7 +1857,7 @@ static int sdp_print_hid_language_list_cb2(const uint8_t *element,
 {
     SdpContext *context = my_context;
     sdp_print_element(context, context->expected_type, element);
-    if (vis()) printf(" ");
+    if (vis()) sdp_printf(" ");
     context->sequence_index++;
     return 0;
 }
@@ -1434,9 +1873,9 @@ static int sdp_print_hid_language_list_cb(const uint8_t *element,
         return 0;
     }
 
-    if (vis()) { printf("\n"); }
+    if (vis()) { sdp_printf("\n"); }
     s_dump_row++;
-    if (vis()) { indent(context); printf("- "); }
+    if (vis()) { indent(context); sdp_printf("- "); }
     context->sequence_index = 0;
     context->indent++;
     context->expected_type = SDP_TYPE_HEX16;
@@ -1465,9 +1904,9 @@ static int sdp_print_language_list_cb(const uint8_t *element,
     SdpContext *context = my_context;
     int el_index = context->sequence_index % 3;
     if (el_index == 0) {
-        if (vis()) printf("\n");
+        if (vis()) sdp_printf("\n");
         s_dump_row++;
-        if (vis()) { indent(context); printf("- "); }
+        if (vis()) { indent(context); sdp_printf("- "); }
         context->expected_type = SDP_TYPE_LANG_CODE;
     } else {
         context->expected_type = SDP_TYPE_HEX16;
@@ -1476,7 +1915,7 @@ static int sdp_print_language_list_cb(const uint8_t *element,
             int pos = de_get_header_size(element);
             context->lang_offset = big_endian_read_16(element, pos);
         }
-        if (vis()) printf(" ");
+        if (vis()) sdp_printf(" ");
     }
     sdp_print_element(context, context->expected_type, element);
     context->sequence_index++;
@@ -1496,29 +1935,25 @@ static void sdp_print_language_list(SdpContext *context, SdpAttributeValueType t
     de_traverse_sequence(element, sdp_print_language_list_cb, context);
 }
 
-static int sdp_print_attr_list_cb(const uint8_t *element,
-                                  de_type_t type, de_size_t size,
-                                  void *my_context)
+/* Returns true if the element is a nested attribute list */
+static bool sdp_print_attr_list_item(const uint8_t *element,
+                                     de_type_t type, de_size_t size,
+                                     SdpContext *context)
 {
-    SdpContext *context = my_context;
-
     if (context->is_attribute) {
         if (type == DE_DES) {
-            if (vis()) { indent(context); printf("Attribute list:\n"); }
+            if (vis()) { indent(context); sdp_printf("Attribute list:\n"); }
             s_dump_row++;
-            context->indent++;
-            de_traverse_sequence(element, sdp_print_attr_list_cb, context);
-            context->indent--;
-            return 0;
+            return true;
         }
         print_attribute_id(context, element, type, size);
     } else {
         sdp_print_element(context, context->expected_type, element);
-        if (vis()) printf("\n");
+        if (vis()) sdp_printf("\n");
         s_dump_row++;
     }
     context->is_attribute = !context->is_attribute;
-    return 0;
+    return false;
 }
 
 static void sdp_print_attr_list(SdpContext *context, SdpAttributeValueType t,
@@ -1530,8 +1965,20 @@ static void sdp_print_attr_list(SdpContext *context, SdpAttributeValueType t,
         return;
     }
 
+    /* Nested attribute lists are entered in place, indented by depth */
+    int base_indent = context->indent;
+    de_cursor_t cursor;
+    de_cursor_init(&cursor, element, de_get_len(element));
+    de_cursor_next(&cursor, false);
+    bool enter = true;
     context->is_attribute = true;
-    de_traverse_sequence(element, sdp_print_attr_list_cb, context);
+    while (de_cursor_next(&cursor, enter)) {
+        const uint8_t *item = de_cursor_element(&cursor);
+        context->indent = base_indent + cursor.depth - 1;
+        enter = sdp_print_attr_list_item(item, de_get_element_type(item),
+                                         de_get_size_type(item), context);
+    }
+    context->indent = base_indent;
 }
 
 static const SdpPrintFunc s_sdp_print_funcs[] = {
@@ -1540,7 +1987,7 @@ static const SdpPrintFunc s_sdp_print_funcs[] = {
     [SDP_TYPE_UINT8] = sdp_print_uint,
     [SDP_TYPE_UINT16] = sdp_print_uint,
     [SDP_TYPE_UINT32] = sdp_print_uint,
-    [SDP_TYPE_HEX8] = sdp_print_generic,
+    [SDP_TYPE_HEX8] = sdp_print_hex8,
     [SDP_TYPE_HEX16] = sdp_print_hex16,
     [SDP_TYPE_HEX32] = sdp_print_hex32,
     [SDP_TYPE_UUID] = sdp_print_uuid,
@@ -1563,18 +2010,515 @@ static const SdpPrintFunc s_sdp_print_funcs[] = {
 static void sdp_print_element(SdpContext *context, SdpAttributeValueType type,
                               const uint8_t *element)
 {
-    if (type >= SDP_TYPE_LAST) {
+    if (type >= SDP_TYPE_LAST || de_get_element_type(element) == DE_NIL) {
         type = SDP_TYPE_ANY;
     }
 
     s_sdp_print_funcs[type](context, type, element);
 }
 
-void sdp_print_attribute_list(const uint8_t *record, int from_row, int max_rows)
+void sdp_print_attribute_list(const uint8_t *record, uint32_t size,
+                              int from_row, int max_rows)
 {
     SdpContext context = { 0, };
     s_dump_row = 0;
     s_dump_from_row = from_row;
     s_dump_max_rows = max_rows;
+    /* The printers trust the lengths found in the record, so check them all
+     * once here; if that fails, show what can be decoded safely. */
+    if (!de_validate(record, size, NULL)) {
+        de_dump_tree(record, size, 0);
+        return;
+    }
     sdp_print_attr_list(&context, SDP_ATTR_LIST, record);
 }
+
+// MARK: Response walker
+/*
+ * Renders a response held in an SdpStore one row, or one attribute, at a
+ * time, and can resume where it stopped once more data has arrived.
+ * Sequences are walked by offset: only the elements handed to the printers
+ * need to be contiguous.
+ */
+typedef struct {
+    uint32_t pos; /* next element to render */
+    uint32_t end[DE_CURSOR_MAX_DEPTH + 1];
+    int depth;
+    bool raw; /* de_dump_data_element() output */
+    bool done;
+    bool error;
+    SdpContext context;
+} SdpWalker;
+
+typedef enum {
+    SDP_WALK_WAIT = 0, /* not even the header has been received */
+    SDP_WALK_HEADER, /* only the beginning has been received */
+    SDP_WALK_COMPLETE,
+    SDP_WALK_ERROR,
+} SdpWalkStatus;
+
+static void sdp_row_index_add(uint32_t offset, uint32_t len, int depth,
+                              const SdpContext *context, bool error);
+
+static void sdp_walker_init(SdpWalker *walker, bool raw)
+{
+    memset(walker, 0, sizeof(*walker));
+    walker->raw = raw;
+    walker->end[0] = UINT32_MAX;
+}
+
+/* Checks how much of the element at offset has been received so far */
+static SdpWalkStatus sdp_walker_peek(const SdpWalker *walker,
+                                     const SdpStore *store, uint32_t size,
+                                     uint32_t offset, uint32_t *len)
+{
+    uint32_t end = walker->end[walker->depth];
+    if (offset >= end) return SDP_WALK_ERROR;
+    if (offset >= size) return SDP_WALK_WAIT;
+
+    uint8_t header[5];
+    uint32_t available = size - offset;
+    sdp_store_read(store, offset, header,
+                   available < sizeof(header) ? available : sizeof(header));
+    if (de_get_header_size(header) > available) return SDP_WALK_WAIT;
+    /* The sequence we are in knows how long the element can be */
+    *len = de_get_len_safe(header, end - offset);
+    if (*len == 0) return SDP_WALK_ERROR;
+    return *len <= available ? SDP_WALK_COMPLETE : SDP_WALK_HEADER;
+}
+
+/* Renders a sequence header or a leaf element; in the attribute view, a
+ * leaf element is an attribute ID immediately followed by its value */
+static void sdp_walker_render(bool raw, int depth, SdpContext *context,
+                              const uint8_t *element)
+{
+    de_type_t type = de_get_element_type(element);
+    de_size_t size = de_get_size_type(element);
+    if (raw) {
+        de_dump_row(element, type, size, depth);
+    } else if (depth == 0) {
+        context->is_attribute = true;
+    } else {
+        context->indent = depth - 1;
+        sdp_print_attr_list_item(element, type, size, context);
+        if (type != DE_DES) {
+            const uint8_t *value = element + de_get_len(element);
+            sdp_print_attr_list_item(value, de_get_element_type(value),
+                                     de_get_size_type(value), context);
+        }
+    }
+}
+
+/* Renders the next element, if enough of it has been received */
+static bool sdp_walker_step(SdpWalker *walker, SdpStore *store, uint32_t size)
+{
+    while (walker->depth > 0 && walker->pos >= walker->end[walker->depth]) {
+        walker->depth--;
+    }
+    if (walker->depth == 0 && walker->pos > 0) {
+        walker->done = true;
+        return false;
+    }
+
+    uint32_t len;
+    SdpWalkStatus status = sdp_walker_peek(walker, store, size,
+                                           walker->pos, &len);
+    if (status == SDP_WALK_WAIT) return false;
+    if (status == SDP_WALK_ERROR) {
+        walker->error = true;
+        return false;
+    }
+
+    uint8_t header;
+    sdp_store_read(store, walker->pos, &header, 1);
+    bool enter = de_get_element_type(&header) == DE_DES;
+    if (!enter && !walker->raw && walker->depth == 0) {
+        /* The attribute view needs a list at the root */
+        walker->error = true;
+        return false;
+    }
+
+    /* Sequences are shown as soon as their header is here */
+    uint32_t needed = de_get_header_size(&header);
+    if (!enter) {
+        if (status != SDP_WALK_COMPLETE) return false;
+        needed = len;
+        if (!walker->raw) {
+            /* Wait for the value of the attribute, too */
+            uint32_t value_len;
+            status = sdp_walker_peek(walker, store, size,
+                                     walker->pos + len, &value_len);
+            if (status == SDP_WALK_ERROR) {
+                walker->error = true;
+                return false;
+            }
+            if (status != SDP_WALK_COMPLETE) return false;
+            needed += value_len;
+        }
+    }
+
+    const uint8_t *element = sdp_store_get(store, walker->pos, needed);
+    /* The printers trust the lengths found in the value, which need to be
+     * checked unless the whole response has been */
+    bool trusted = store->trusted && size == store->len;
+    if (!element ||
+        (!enter && !walker->raw && !trusted &&
+         !de_validate(element + len, needed - len, NULL))) {
+        walker->error = true;
+        return false;
+    }
+    if (walker->raw || walker->depth > 0) {
+        sdp_row_index_add(walker->pos, needed, walker->depth,
+                          &walker->context, false);
+    }
+    sdp_walker_render(walker->raw, walker->depth, &walker->context, element);
+
+    if (enter) {
+        if (walker->depth >= DE_CURSOR_MAX_DEPTH) {
+            walker->error = true;
+            return false;
+        }
+        walker->depth++;
+        walker->end[walker->depth] = walker->pos + len;
+    }
+    walker->pos += needed;
+    return true;
+}
+
+/* Whatever could not be rendered is malformed or missing */
+static void sdp_walker_finish(const SdpWalker *walker, uint32_t size)
+{
+    if (size == 0 || (walker->done && walker->pos == size)) return;
+
+    int indent = walker->raw ? walker->depth : 0;
+    sdp_row_index_add(walker->pos, 0, indent, &walker->context, true);
+    de_dump_error(walker->pos, indent);
+}
+
+static void sdp_walk(SdpStore *store, uint32_t size, bool raw)
+{
+    SdpWalker walker;
+    sdp_walker_init(&walker, raw);
+    while (sdp_walker_step(&walker, store, size)) {}
+    sdp_walker_finish(&walker, size);
+}
+
+// MARK: Row index
+struct SdpRowIndexEntry {
+    uint32_t offset;
+    uint32_t len; /* bytes needed to render the row */
+    int row;
+    int depth;
+    bool error; /* the data at offset is malformed */
+    SdpContext context;
+};
+
+static SdpRowIndex *s_building_index = NULL;
+
+static void sdp_row_index_add(uint32_t offset, uint32_t len, int depth,
+                              const SdpContext *context, bool error)
+{
+    SdpRowIndex *index = s_building_index;
+    if (!index || !index->valid) return;
+
+    if (index->num_entries >= index->capacity) {
+        int capacity = index->capacity > 0 ? index->capacity * 2 : 64;
+        SdpRowIndexEntry *entries =
+            realloc(index->entries, capacity * sizeof(SdpRowIndexEntry));
+        if (!entries) {
+            /* Out of memory: the printers will walk the whole record */
+            index->valid = false;
+            return;
+        }
+        index->entries = entries;
+        index->capacity = capacity;
+    }
+
+    SdpRowIndexEntry *entry = &index->entries[index->num_entries++];
+    entry->offset = offset;
+    entry->len = len;
+    entry->row = s_dump_row;
+    entry->depth = depth;
+    entry->error = error;
+    entry->context = *context;
+}
+
+void sdp_row_index_clear(SdpRowIndex *index)
+{
+    free(index->entries);
+    memset(index, 0, sizeof(*index));
+}
+
+void sdp_row_index_build(SdpRowIndex *index, SdpStore *record,
+                         uint32_t size, bool raw)
+{
+    index->num_entries = 0;
+    index->num_rows = 0;
+    index->raw = raw;
+    index->valid = true;
+
+    s_building_index = index;
+    /* Nothing is visible: we only count the rows */
+    s_dump_row = 0;
+    s_dump_from_row = INT32_MAX;
+    s_dump_max_rows = 0;
+    sdp_walk(record, size, raw);
+    s_building_index = NULL;
+
+    index->num_rows = s_dump_row;
+    index->size = size;
+    index->built = true;
+}
+
+/* Returns the first entry contributing to the given row */
+static int sdp_row_index_find(const SdpRowIndex *index, int row)
+{
+    int lo = 0, hi = index->num_entries;
+    while (hi - lo > 1) {
+        int mid = (lo + hi) / 2;
+        if (index->entries[mid].row <= row) lo = mid;
+        else hi = mid;
+    }
+    return lo;
+}
+
+void sdp_row_index_print(const SdpRowIndex *index, SdpStore *record,
+                         int from_row, int max_rows)
+{
+    s_dump_from_row = from_row;
+    s_dump_max_rows = max_rows;
+    if (!index->valid) {
+        s_dump_row = 0;
+        sdp_walk(record, index->size, index->raw);
+        return;
+    }
+
+    for (int i = sdp_row_index_find(index, from_row);
+         i < index->num_entries; i++) {
+        const SdpRowIndexEntry *entry = &index->entries[i];
+        if (entry->row >= from_row + max_rows) break;
+
+        s_dump_row = entry->row;
+        if (entry->error) {
+            de_dump_error(entry->offset, entry->depth);
+            continue;
+        }
+        const uint8_t *element = sdp_store_get(record, entry->offset,
+                                               entry->len);
+        if (!element) break;
+        /* Nested lists have their own entries, so nothing is entered */
+        SdpContext context = entry->context;
+        sdp_walker_render(index->raw, entry->depth, &context, element);
+    }
+}
+
+// MARK: Line cache
+struct SdpLineCacheStream {
+    SdpWalker walker;
+    int num_rows;
+};
+
+struct SdpLineItem {
+    int row;
+    RiItem item;
+};
+
+static bool sdp_line_cache_reserve(SdpLineCache *cache, uint32_t text_len,
+                                   int num_lines)
+{
+    if (text_len > cache->text_capacity) {
+        uint32_t capacity = cache->text_capacity > 0 ? cache->text_capacity : 4096;
+        while (capacity < text_len) capacity *= 2;
+        char *text = realloc(cache->text, capacity);
+        if (!text) return false;
+        cache->text = text;
+        cache->text_capacity = capacity;
+    }
+
+    if (num_lines > cache->lines_capacity) {
+        int capacity = cache->lines_capacity > 0 ? cache->lines_capacity : 128;
+        while (capacity < num_lines) capacity *= 2;
+        uint32_t *lines = realloc(cache->lines, capacity * sizeof(uint32_t));
+        if (!lines) return false;
+        cache->lines = lines;
+        cache->lines_capacity = capacity;
+    }
+    return true;
+}
+
+static void sdp_line_cache_append(SdpLineCache *cache, const char *format,
+                                  va_list args)
+{
+    if (!cache->valid) return;
+
+    va_list measure_args;
+    va_copy(measure_args, args);
+    int len = vsnprintf(NULL, 0, format, measure_args);
+    va_end(measure_args);
+    if (len <= 0) return;
+
+    /* One more byte for the terminator written by vsnprintf() */
+    if (!sdp_line_cache_reserve(cache, cache->text_len + len + 1,
+                                cache->num_lines + 1)) {
+        cache->valid = false;
+        return;
+    }
+    char *text = cache->text + cache->text_len;
+    vsnprintf(text, len + 1, format, args);
+    cache->text_len += len;
+
+    /* Every newline completes a row; lines[num_lines] is where the row
+     * being written begins */
+    for (int i = 0; i < len; i++) {
+        if (text[i] != '\n') continue;
+        text[i] = '\0';
+        if (!sdp_line_cache_reserve(cache, cache->text_len,
+                                    cache->num_lines + 2)) {
+            cache->valid = false;
+            return;
+        }
+        cache->lines[++cache->num_lines] = text + i + 1 - cache->text;
+    }
+}
+
+static void sdp_line_cache_add_item(SdpLineCache *cache, const RiItem *item)
+{
+    if (!cache->valid) return;
+
+    if (cache->num_items == cache->items_capacity) {
+        int capacity = cache->items_capacity > 0 ? cache->items_capacity * 2 : 64;
+        SdpLineItem *items = realloc(cache->items, capacity * sizeof(SdpLineItem));
+        if (!items) {
+            cache->valid = false;
+            return;
+        }
+        cache->items = items;
+        cache->items_capacity = capacity;
+    }
+    /* The row being written */
+    SdpLineItem *entry = &cache->items[cache->num_items++];
+    entry->row = cache->num_lines;
+    entry->item = *item;
+}
+
+static void sdp_line_cache_reset(SdpLineCache *cache, bool raw)
+{
+    free(cache->stream);
+    cache->stream = NULL;
+    cache->text_len = 0;
+    cache->num_lines = 0;
+    cache->num_items = 0;
+    cache->raw = raw;
+    cache->built = false;
+    cache->valid = sdp_line_cache_reserve(cache, 1, 1);
+    if (cache->valid) {
+        cache->lines[0] = 0;
+    }
+}
+
+/* Terminates the text, counting the last row even if it has no newline */
+static void sdp_line_cache_complete(SdpLineCache *cache)
+{
+    free(cache->stream);
+    cache->stream = NULL;
+    if (cache->valid) {
+        cache->text[cache->text_len] = '\0';
+        if (cache->lines[cache->num_lines] < cache->text_len) {
+            cache->num_lines++;
+        }
+    }
+    cache->built = true;
+}
+
+void sdp_line_cache_clear(SdpLineCache *cache)
+{
+    free(cache->stream);
+    free(cache->text);
+    free(cache->lines);
+    free(cache->items);
+    memset(cache, 0, sizeof(*cache));
+}
+
+void sdp_line_cache_build(SdpLineCache *cache, SdpStore *record,
+                          uint32_t size, bool raw)
+{
+    sdp_line_cache_reset(cache, raw);
+
+    /* Render everything: all rows are visible */
+    s_line_cache = cache;
+    s_dump_row = 0;
+    s_dump_from_row = 0;
+    s_dump_max_rows = INT32_MAX;
+    sdp_walk(record, size, raw);
+    s_line_cache = NULL;
+
+    sdp_line_cache_complete(cache);
+}
+
+void sdp_line_cache_feed(SdpLineCache *cache, SdpStore *record,
+                         uint32_t size, bool raw)
+{
+    if (cache->raw != raw || (!cache->stream && !cache->built)) {
+        sdp_line_cache_reset(cache, raw);
+        cache->stream = malloc(sizeof(SdpLineCacheStream));
+        if (!cache->stream) {
+            cache->valid = false;
+            return;
+        }
+        sdp_walker_init(&cache->stream->walker, raw);
+        cache->stream->num_rows = 0;
+    }
+
+    SdpLineCacheStream *stream = cache->stream;
+    if (!stream) return;
+
+    s_line_cache = cache;
+    s_dump_row = stream->num_rows;
+    s_dump_from_row = 0;
+    s_dump_max_rows = INT32_MAX;
+    while (cache->valid && sdp_walker_step(&stream->walker, record, size)) {}
+    stream->num_rows = s_dump_row;
+    s_line_cache = NULL;
+}
+
+void sdp_line_cache_finish(SdpLineCache *cache, SdpStore *record,
+                           uint32_t size, bool raw)
+{
+    if (cache->built && cache->raw == raw) return;
+
+    sdp_line_cache_feed(cache, record, size, raw);
+    if (!cache->stream) {
+        /* Out of memory for the walker state: try again from scratch */
+        sdp_line_cache_build(cache, record, size, raw);
+        return;
+    }
+
+    s_line_cache = cache;
+    s_dump_row = cache->stream->num_rows;
+    sdp_walker_finish(&cache->stream->walker, size);
+    s_line_cache = NULL;
+    sdp_line_cache_complete(cache);
+}
+
+void sdp_line_cache_print(const SdpLineCache *cache, int from_row, int max_rows)
+{
+    /* The first item at or after from_row */
+    int item = 0;
+    int last = cache->num_items;
+    while (item < last) {
+        int middle = item + (last - item) / 2;
+        if (cache->items[middle].row < from_row) item = middle + 1;
+        else last = middle;
+    }
+
+    for (int row = from_row;
+         row < cache->num_lines && row < from_row + max_rows;
+         row++) {
+        printf("%s", cache->text + cache->lines[row]);
+        if (item < cache->num_items && cache->items[item].row == row) {
+            char text[RI_ITEM_STR_SIZE];
+            printf("%s", ri_FormatItem(&cache->items[item++].item, text));
+        }
+        printf("\n");
+    }
+}
@@ -46,6 +46,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "sdp_store.h"
+
 #if defined __cplusplus
 extern "C" {
 #endif
@@ -94,7 +96,7 @@ typedef enum {
 } de_size_t;
 
 // MARK: DateElement
-void      de_dump_data_element(const uint8_t * record, int from_row, int max_rows);
+void      de_dump_data_element(const uint8_t * record, uint32_t size, int from_row, int max_rows);
 uint32_t  de_get_len(const uint8_t * header);
 
 
@@ -136,6 +138,83 @@ uint16_t  des_iterator_get_size (des_iterator_t * it);
 uint8_t * des_iterator_get_element(des_iterator_t * it);
 void      des_iterator_next(des_iterator_t * it);
 
+// MARK: DES cursor
+// Depth-first walk over nested data elements, without recursion. Each element
+// is checked to fit in its enclosing sequence before it is returned; the only
+// exception is a sequence cut short, which can be entered up to the cut.
+// Trusted cursors skip the checks, for data which has been validated once.
+// Store cursors walk an SdpStore by offset and never need it contiguous: the
+// current element is copied, up to DE_CURSOR_ELEMENT_SIZE bytes, which is
+// enough for its header and for any value but strings and URLs.
+#define DE_CURSOR_MAX_DEPTH 16
+#define DE_CURSOR_ELEMENT_SIZE 32
+
+typedef struct {
+    const uint8_t * data;
+    const SdpStore * store; // set instead of data for store cursors
+    uint8_t  element[DE_CURSOR_ELEMENT_SIZE]; // copy of the current element
+    uint32_t pos;   // offset of the current element
+    uint32_t len;   // length of the current element
+    uint32_t end[DE_CURSOR_MAX_DEPTH + 1]; // ends of the enclosing sequences
+    int      depth; // 0 for top level elements
+    uint32_t truncated_levels; // bit set for each sequence which is cut short
+    bool     truncated; // the current element is a sequence which is cut short
+    bool     started;
+    bool     error;
+    bool     trusted; // lengths are not checked against the enclosing sequence
+} de_cursor_t;
+
+void      de_cursor_init(de_cursor_t * cursor, const uint8_t * data, uint32_t size);
+// same as above, for data which has already passed de_validate()
+void      de_cursor_init_trusted(de_cursor_t * cursor, const uint8_t * data, uint32_t size);
+// walks the size bytes of store from offset; positions are offsets in store
+void      de_cursor_init_store(de_cursor_t * cursor, const SdpStore * store, uint32_t offset, uint32_t size);
+// moves to the first/next element; if enter is set and the current element
+// is a DES or DEA, moves to its first child instead of its next sibling
+bool      de_cursor_next(de_cursor_t * cursor, bool enter);
+const uint8_t * de_cursor_element(const de_cursor_t * cursor);
+// returns true if all elements in data, nested ones included, are well formed
+bool      de_validate(const uint8_t * data, uint32_t size, uint32_t * error_offset);
+// validates all the data in store once, a block at a time, and marks it as
+// trusted if it is well formed; later calls return the cached result
+bool      de_validate_store(SdpStore * store);
+
+// MARK: UUID interning
+// UUIDs on the Bluetooth Base UUID are kept as their 32-bit value, all others
+// as two 64-bit words, so that comparing them never takes a 16-byte memcmp
+typedef struct {
+    bool     is_uuid32;
+    uint32_t uuid32;
+    uint64_t words[2];
+} sdp_uuid_t;
+
+// A set of UUIDs, such as those of a ServiceSearchPattern, each with a small
+// integer ID so that matching them against a record yields a bitmask
+#define SDP_UUID_TABLE_MAX_UUIDS 32
+
+typedef struct {
+    uint32_t uuid32s[SDP_UUID_TABLE_MAX_UUIDS];
+    uint8_t  uuid32_ids[SDP_UUID_TABLE_MAX_UUIDS];
+    uint8_t  num_uuid32s;
+    uint64_t uuid128s[SDP_UUID_TABLE_MAX_UUIDS][2];
+    uint8_t  uuid128_ids[SDP_UUID_TABLE_MAX_UUIDS];
+    uint8_t  num_uuid128s;
+    uint8_t  num_ids;
+} sdp_uuid_table_t;
+
+void      sdp_uuid_from_uuid128(sdp_uuid_t *uuid, const uint8_t *uuid128);
+// @return: element is valid UUID
+bool      de_get_compact_uuid(const uint8_t *element, sdp_uuid_t *uuid);
+void      sdp_uuid_table_init(sdp_uuid_table_t *table);
+// @return ID of uuid, adding it if needed; -1 if the table is full
+int       sdp_uuid_table_intern(sdp_uuid_table_t *table, const sdp_uuid_t *uuid);
+// @return ID of uuid, -1 if it is not in the table
+int       sdp_uuid_table_lookup(const sdp_uuid_table_t *table, const sdp_uuid_t *uuid);
+// @return false if the pattern holds anything but UUIDs, or too many of them
+bool      sdp_uuid_table_intern_pattern(sdp_uuid_table_t *table, const uint8_t *serviceSearchPattern);
+// @return bitmask of the IDs of the UUIDs in table found in record, at any nesting level
+uint32_t  sdp_record_find_uuids(const uint8_t *record, const sdp_uuid_table_t *table);
+
 // MARK: SDP
 uint16_t  sdp_append_attributes_in_attributeIDList(uint8_t *record, uint8_t *attributeIDList, uint16_t startOffset, uint16_t maxBytes, uint8_t *buffer);
 const uint8_t * sdp_get_attribute_value_for_attribute_id(uint8_t * record, uint16_t attributeID);
@@ -158,9 +237,106 @@ uint8_t* sdp_service_search_pattern_for_uuid16(uint16_t uuid16);
  */
 uint8_t* sdp_service_search_pattern_for_uuid128(const uint8_t * uuid128);
 
+/* The SDP specification allows up to 12 UUIDs in a ServiceSearchPattern */
+#define SDP_SERVICE_SEARCH_PATTERN_MAX_UUIDS 12
+#define SDP_SERVICE_SEARCH_PATTERN_MAX_SIZE \
+    (3 + SDP_SERVICE_SEARCH_PATTERN_MAX_UUIDS * 17)
+
+/*
+ * @brief Writes a service search pattern for the given UUIDs into buffer
+ * @param uuid128s holds num_uuid128s consecutive 16-byte UUIDs
+ * @note A record matches the pattern only if it contains all of its UUIDs
+ * @return size of the pattern, 0 if it does not fit into buffer_size
+ */
+uint16_t sdp_service_search_pattern_build(uint8_t *buffer, uint16_t buffer_size,
+                                          const uint16_t *uuid16s, int num_uuid16s,
+                                          const uint8_t *uuid128s, int num_uuid128s);
+
+/* Attribute IDs from first to last, both included */
+typedef struct {
+    uint16_t first;
+    uint16_t last;
+} SdpAttributeRange;
+
+#define SDP_ATTRIBUTE_ID_LIST_MAX_RANGES 16
+#define SDP_ATTRIBUTE_ID_LIST_MAX_SIZE \
+    (3 + SDP_ATTRIBUTE_ID_LIST_MAX_RANGES * 5)
+
+/*
+ * @brief Writes an AttributeIDList for the given ranges into buffer; ranges
+ * made of a single ID are written as such
+ * @return size of the list, 0 if it does not fit into buffer_size
+ */
+uint16_t sdp_attribute_id_list_build(uint8_t *buffer, uint16_t buffer_size,
+                                     const SdpAttributeRange *ranges,
+                                     int num_ranges);
+
 /* API_END */
 
-void sdp_print_attribute_list(const uint8_t *record, int from_row, int max_rows);
+void sdp_print_attribute_list(const uint8_t *record, uint32_t size,
+                              int from_row, int max_rows);
+
+/*
+ * Row index over the rendered output of a record, built once so that the
+ * viewer can draw any window of rows without walking the record from its
+ * root.
+ */
+typedef struct SdpRowIndexEntry SdpRowIndexEntry;
+
+typedef struct {
+    SdpRowIndexEntry *entries;
+    int num_entries;
+    int capacity;
+    int num_rows;
+    uint32_t size; /* of the record */
+    bool raw; /* indexes de_dump_data_element() output */
+    bool built;
+    bool valid;
+} SdpRowIndex;
+
+void sdp_row_index_build(SdpRowIndex *index, SdpStore *record,
+                         uint32_t size, bool raw);
+void sdp_row_index_clear(SdpRowIndex *index);
+void sdp_row_index_print(const SdpRowIndex *index, SdpStore *record,
+                         int from_row, int max_rows);
+
+/*
+ * Rendered text of a record, one string per row, stored in a single arena.
+ * Redrawing a window of rows is then just copying them out. The text can be
+ * built at once, or fed the response as it arrives: each element is then
+ * rendered as soon as it is complete. The items of HID report descriptors,
+ * which can run to hundreds of rows, are kept as records instead, and only
+ * formatted when their row is printed.
+ */
+typedef struct SdpLineCacheStream SdpLineCacheStream;
+typedef struct SdpLineItem SdpLineItem;
+
+typedef struct {
+    char *text;
+    uint32_t text_len;
+    uint32_t text_capacity;
+    uint32_t *lines; /* offset of each row in text */
+    int num_lines;
+    int lines_capacity;
+    SdpLineItem *items; /* by row; the text of their rows is the indent */
+    int num_items;
+    int items_capacity;
+    SdpLineCacheStream *stream; /* set while the record is being fed */
+    bool raw; /* holds de_dump_data_element() output */
+    bool built;
+    bool valid;
+} SdpLineCache;
+
+void sdp_line_cache_build(SdpLineCache *cache, SdpStore *record,
+                          uint32_t size, bool raw);
+/* The first size bytes of record have been received */
+void sdp_line_cache_feed(SdpLineCache *cache, SdpStore *record,
+                         uint32_t size, bool raw);
+/* The record is complete */
+void sdp_line_cache_finish(SdpLineCache *cache, SdpStore *record,
+                           uint32_t size, bool raw);
+void sdp_line_cache_clear(SdpLineCache *cache);
+void sdp_line_cache_print(const SdpLineCache *cache, int from_row, int max_rows);
 
 #if defined __cplusplus
 }
@@ -0,0 +1,127 @@
+/*
+ * Checks the extraction kernels picked by hid_layout_compile() against the
+ * generic extraction, on fields of random size, offset and logical range.
+ */
+#include "hid_layout.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_DESCRIPTORS 2000
+#define NUM_REPORTS 20
+#define MAX_VALUES 64
+
+static int s_failures = 0;
+
+static uint8_t *add_item(uint8_t *item, uint8_t prefix, int32_t data)
+{
+    /* Always with four bytes of data, which any size fits in */
+    *item++ = prefix | 3;
+    for (int i = 0; i < 4; i++) *item++ = (uint32_t)data >> (8 * i);
+    return item;
+}
+
+static int random_size(void)
+{
+    static const int sizes[] = { 1, 1, 1, 8, 8, 16, 16, 32 };
+    if (rand() % 4 == 0) return 1 + rand() % 32;
+    return sizes[rand() % (sizeof(sizes) / sizeof(sizes[0]))];
+}
+
+/* Input fields one after the other, so that some are not byte aligned */
+static int build_descriptor(uint8_t *descriptor)
+{
+    uint8_t *item = descriptor;
+    item = add_item(item, 0x04, 0x09); /* Usage Page (Button) */
+    item = add_item(item, 0x18, 1); /* Usage Minimum */
+    item = add_item(item, 0x28, 32); /* Usage Maximum */
+
+    int num_fields = 1 + rand() % 8;
+    for (int i = 0; i < num_fields; i++) {
+        int size = random_size();
+        int count = size == 1 ? 1 + rand() % 40 : 1 + rand() % 4;
+        int32_t min = 0, max = 1;
+        switch (rand() % 3) {
+        case 0: min = -1; max = 0; break;
+        case 1: min = -(rand() % 1000); max = rand() % 1000; break;
+        }
+        item = add_item(item, 0x74, size); /* Report Size */
+        item = add_item(item, 0x94, count); /* Report Count */
+        item = add_item(item, 0x14, min); /* Logical Minimum */
+        item = add_item(item, 0x24, max); /* Logical Maximum */
+        item = add_item(item, 0x80, 0x02); /* Input (Data, Var, Abs) */
+    }
+    return item - descriptor;
+}
+
+static void check_field(const HidLayout *layout, const HidField *field,
+                        const uint8_t *report, uint16_t len)
+{
+    HidField generic = *field;
+    generic.kernel = HID_KERNEL_GENERIC;
+
+    for (uint16_t n = 0; n < field->count; n++) {
+        int32_t value = hid_field_extract(field, report, len, n);
+        int32_t expected = hid_field_extract(&generic, report, len, n);
+        if (value != expected) {
+            printf("extract: kernel %d, size %d, offset %d, min %d, "
+                   "value %d: got %d, expected %d\n",
+                   field->kernel, field->bit_size, field->bit_offset,
+                   field->logical_min, n, value, expected);
+            s_failures++;
+        }
+    }
+
+    HidValue values[MAX_VALUES], expected[MAX_VALUES];
+    int count = hid_field_decode(layout, field, report, len,
+                                 values, MAX_VALUES);
+    hid_field_decode(layout, &generic, report, len, expected, MAX_VALUES);
+    for (int n = 0; n < count && n < MAX_VALUES; n++) {
+        if (values[n].value != expected[n].value ||
+            values[n].usage != expected[n].usage) {
+            printf("decode: kernel %d, size %d, offset %d, min %d, "
+                   "value %d: got %d, expected %d\n",
+                   field->kernel, field->bit_size, field->bit_offset,
+                   field->logical_min, n, values[n].value, expected[n].value);
+            s_failures++;
+        }
+    }
+}
+
+int main(void)
+{
+    static HidLayout layout;
+    uint8_t descriptor[512];
+    uint8_t report[512];
+    int kernels[HID_KERNEL_BITS + 1] = { 0 };
+
+    srand(1);
+    for (int i = 0; i < NUM_DESCRIPTORS; i++) {
+        int len = build_descriptor(descriptor);
+        if (!hid_layout_compile(&layout, descriptor, len)) {
+            printf("descriptor %d did not compile\n", i);
+            return 1;
+        }
+
+        uint16_t size = hid_layout_report_size(&layout, HID_REPORT_INPUT, 0);
+        for (int r = 0; r < NUM_REPORTS; r++) {
+            for (int b = 0; b < size; b++) report[b] = rand();
+            /* Now and then cut short, so that the last values are missing */
+            uint16_t report_len = rand() % 8 == 0 ? rand() % (size + 1) : size;
+            for (int f = 0; f < layout.num_fields; f++) {
+                check_field(&layout, &layout.fields[f], report, report_len);
+            }
+        }
+        for (int f = 0; f < layout.num_fields; f++) {
+            kernels[layout.fields[f].kernel]++;
+        }
+    }
+
+    printf("hid_kernels: fields by kernel: generic %d, u8 %d, u16 %d, "
+           "u32 %d, bits %d; %d failures\n",
+           kernels[HID_KERNEL_GENERIC], kernels[HID_KERNEL_U8],
+           kernels[HID_KERNEL_U16], kernels[HID_KERNEL_U32],
+           kernels[HID_KERNEL_BITS], s_failures);
+    return s_failures == 0 ? 0 : 1;
+}